@@ -87,6 +87,10 @@ class Adafruit_GFX : public Print {
   int16_t getCursorY(void) const;
 
  protected:
+  template<class D> friend struct Adafruit_GFX_Core;
+
+  static const unsigned char * const classicFont; // 5x7 font in PROGMEM
+
   const int16_t
     WIDTH, HEIGHT;   // This is the 'raw' display w/h - never changes
   int16_t
@@ -104,6 +108,8 @@ class Adafruit_GFX : public Print {
     *gfxFont;
 };
 
+#include "Adafruit_GFX_Core.h"
+
 class Adafruit_GFX_Button {
 
  public:
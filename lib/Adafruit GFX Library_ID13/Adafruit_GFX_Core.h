@@ -0,0 +1,776 @@
+#ifndef _ADAFRUIT_GFX_CORE_H
+#define _ADAFRUIT_GFX_CORE_H
+
+// The drawing primitives of Adafruit_GFX, written once as templates on the
+// display type D.  Each takes the display as its first argument and draws
+// through its drawPixel(), drawFastVLine(), drawFastHLine(), drawLine() and
+// fillRect().  Adafruit_GFX instantiates them with D = Adafruit_GFX, so those
+// calls stay virtual.  A display derived from Adafruit_GFX_Fast<D> gets them
+// instantiated for its own type instead; if D is final the compiler binds
+// the calls statically and can inline them into the loops.
+//
+// Included from the end of Adafruit_GFX.h, not meant to be used on its own.
+
+// Many (but maybe not all) non-AVR board installs define macros
+// for compatibility with existing PROGMEM-reading AVR code.
+// Do our own checks and defines here for good measure...
+
+#ifndef pgm_read_byte
+ #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#endif
+#ifndef pgm_read_word
+ #define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#endif
+#ifndef pgm_read_dword
+ #define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#endif
+
+// Pointers are a peculiar case...typically 16-bit on AVR boards,
+// 32 bits elsewhere.  Try to accommodate both...
+
+#if !defined(__INT_MAX__) || (__INT_MAX__ > 0xFFFF)
+ #define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+#else
+ #define pgm_read_pointer(addr) ((void *)pgm_read_word(addr))
+#endif
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
+#endif
+
+// One edge of a filled shape, stepped a scanline at a time.  x follows
+// x0 + dx * n / dy, truncated like the division it replaces, using the
+// quotient and remainder of dx / dy worked out once rather than a 32-bit
+// division on every scanline.  dy must be positive.
+struct Adafruit_GFX_Edge {
+  int16_t  x, step;
+  uint16_t err, errStep, dy;
+  int8_t   dir;
+
+  void start(int16_t x0, int16_t dx, int16_t dy0) {
+    uint16_t adx = (dx < 0) ? -dx : dx;
+    dir     = (dx < 0) ? -1 : 1;
+    dy      = dy0;
+    step    = dir * (int16_t)(adx / dy);
+    errStep = adx % dy;
+    err     = 0;
+    x       = x0;
+  }
+
+  void next(void) {
+    x   += step;
+    err += errStep;
+    if(err >= dy) {
+      err -= dy;
+      x   += dir;
+    }
+  }
+};
+
+// The scanlines of a filled triangle, passed to span(a, b, y) with a <= b.
+// Same rows and end points as the original division-based fillTriangle();
+// devices with a faster way to fill a row can supply their own span.
+template<class Span> void Adafruit_GFX_triangleSpans(int16_t x0, int16_t y0,
+ int16_t x1, int16_t y1, int16_t x2, int16_t y2, Span &span) {
+
+  int16_t a, b, y, last;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if (y0 > y1) {
+    _swap_int16_t(y0, y1); _swap_int16_t(x0, x1);
+  }
+  if (y1 > y2) {
+    _swap_int16_t(y2, y1); _swap_int16_t(x2, x1);
+  }
+  if (y0 > y1) {
+    _swap_int16_t(y0, y1); _swap_int16_t(x0, x1);
+  }
+
+  if(y0 == y2) { // Handle awkward all-on-same-line case as its own thing
+    a = b = x0;
+    if(x1 < a)      a = x1;
+    else if(x1 > b) b = x1;
+    if(x2 < a)      a = x2;
+    else if(x2 > b) b = x2;
+    span(a, b, y0);
+    return;
+  }
+
+  Adafruit_GFX_Edge ea, eb;
+  eb.start(x0, x2 - x0, y2 - y0);
+
+  // For upper part of triangle, walk segments 0-1 and 0-2.  If y1=y2
+  // (flat-bottomed triangle), the scanline y1 is included here and the
+  // second loop is skipped, otherwise scanline y1 is left to the second
+  // loop.  Segment 0-1 is only set up if it has any height.
+  if(y1 == y2) last = y1;   // Include y1 scanline
+  else         last = y1-1; // Skip it
+
+  if(y1 > y0) ea.start(x0, x1 - x0, y1 - y0);
+  for(y=y0; y<=last; y++) {
+    a = ea.x;
+    b = eb.x;
+    ea.next();
+    eb.next();
+    if(a > b) _swap_int16_t(a,b);
+    span(a, b, y);
+  }
+
+  // For lower part of triangle, walk segments 1-2 and (still) 0-2.
+  // This loop is skipped if y1=y2.
+  if(y <= y2) ea.start(x1, x2 - x1, y2 - y1);
+  for(; y<=y2; y++) {
+    a = ea.x;
+    b = eb.x;
+    ea.next();
+    eb.next();
+    if(a > b) _swap_int16_t(a,b);
+    span(a, b, y);
+  }
+}
+
+// The bytes of a GFXFONT_PAGES or GFXFONT_RLE glyph, a byte for each 8
+// rows (bit 0 at the top), down each column in turn, left to right.
+struct Adafruit_GFX_GlyphReader {
+  const uint8_t *p, *end;
+  uint16_t       run;          // GFXFONT_RLE pixels left in the current run
+  uint8_t        flags, w, h, page, pages, row;
+  boolean        set, low;
+
+  // c is the glyph's code, the font's last code has no glyph after it
+  void start(const GFXfont *f, GFXglyph *glyph, uint8_t c) {
+    const uint8_t *bitmap = (const uint8_t *)pgm_read_pointer(&f->bitmap);
+    p     = bitmap + pgm_read_word(&glyph->bitmapOffset);
+    flags = pgm_read_byte(&f->flags);
+    w     = pgm_read_byte(&glyph->width);
+    h     = pgm_read_byte(&glyph->height);
+    pages = (h + 7) / 8;
+    page  = row = 0;
+    run   = 0;
+    set   = true; // so the first run is blank
+    low   = false;
+    end   = ((flags & GFXFONT_RLE) && (c != (uint8_t)pgm_read_byte(&f->last))) ?
+            bitmap + pgm_read_word(&glyph[1].bitmapOffset) : NULL;
+  }
+
+  uint8_t next(void) {
+    if(!(flags & GFXFONT_RLE)) {
+      // Stored page after page, so a column's bytes are w apart
+      uint8_t bits = pgm_read_byte(p + page * w);
+      if(++page == pages) {
+        page = 0;
+        p++;
+      }
+      return bits;
+    }
+
+    uint8_t bits = 0, bit = 0, n = h - row;
+    if(n > 8) n = 8;
+    row = (row + n == h) ? 0 : row + n;
+    while(bit < n) {
+      if(!run) nextRun();
+      uint8_t take = (run < (uint8_t)(n - bit)) ? run : n - bit;
+      if(set) bits |= (uint8_t)(((1 << take) - 1) << bit);
+      bit += take;
+      run -= take;
+    }
+    return bits;
+  }
+
+  void nextRun(void) {
+    set = !set;
+    if(p == end) {
+      // The rest of the glyph is blank
+      set = false;
+      run = 0xFFFF;
+      return;
+    }
+    uint8_t code;
+    run = 0;
+    do {
+      code = low ? (pgm_read_byte(p++) & 0x0F) : (pgm_read_byte(p) >> 4);
+      low  = !low;
+      run += code;
+    } while(code == 15);
+  }
+};
+
+// The glyph for code c in font f, or NULL if the font has none
+static inline GFXglyph *Adafruit_GFX_findGlyph(const GFXfont *f, uint8_t c) {
+  uint8_t first = pgm_read_byte(&f->first);
+  if((c < first) || (c > (uint8_t)pgm_read_byte(&f->last))) return NULL;
+
+  GFXglyph      *glyph = (GFXglyph *)pgm_read_pointer(&f->glyph);
+  const uint8_t *index = (const uint8_t *)pgm_read_pointer(&f->index);
+  if(!index) return &glyph[c - first];
+
+  // Subset: the index ends with last, so the scan stops by c at most
+  uint8_t code;
+  while((code = pgm_read_byte(index++)) < c) glyph++;
+  return (code == c) ? glyph : NULL;
+}
+
+template<class D> struct Adafruit_GFX_Core {
+
+  // Draw a circle outline
+  static void drawCircle(D &d, int16_t x0, int16_t y0, int16_t r,
+   uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    d.drawPixel(x0  , y0+r, color);
+    d.drawPixel(x0  , y0-r, color);
+    d.drawPixel(x0+r, y0  , color);
+    d.drawPixel(x0-r, y0  , color);
+
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      d.drawPixel(x0 + x, y0 + y, color);
+      d.drawPixel(x0 - x, y0 + y, color);
+      d.drawPixel(x0 + x, y0 - y, color);
+      d.drawPixel(x0 - x, y0 - y, color);
+      d.drawPixel(x0 + y, y0 + x, color);
+      d.drawPixel(x0 - y, y0 + x, color);
+      d.drawPixel(x0 + y, y0 - x, color);
+      d.drawPixel(x0 - y, y0 - x, color);
+    }
+  }
+
+  static void drawCircleHelper(D &d, int16_t x0, int16_t y0,
+   int16_t r, uint8_t cornername, uint16_t color) {
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+      if (cornername & 0x4) {
+        d.drawPixel(x0 + x, y0 + y, color);
+        d.drawPixel(x0 + y, y0 + x, color);
+      }
+      if (cornername & 0x2) {
+        d.drawPixel(x0 + x, y0 - y, color);
+        d.drawPixel(x0 + y, y0 - x, color);
+      }
+      if (cornername & 0x8) {
+        d.drawPixel(x0 - y, y0 + x, color);
+        d.drawPixel(x0 - x, y0 + y, color);
+      }
+      if (cornername & 0x1) {
+        d.drawPixel(x0 - y, y0 - x, color);
+        d.drawPixel(x0 - x, y0 - y, color);
+      }
+    }
+  }
+
+  static void fillCircle(D &d, int16_t x0, int16_t y0, int16_t r,
+   uint16_t color) {
+    d.drawFastVLine(x0, y0-r, 2*r+1, color);
+    fillCircleHelper(d, x0, y0, r, 3, 0, color);
+  }
+
+  // Used to do circles and roundrects
+  static void fillCircleHelper(D &d, int16_t x0, int16_t y0, int16_t r,
+   uint8_t cornername, int16_t delta, uint16_t color) {
+
+    int16_t f     = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x     = 0;
+    int16_t y     = r;
+
+    while (x<y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f     += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f     += ddF_x;
+
+      if (cornername & 0x1) {
+        d.drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
+        d.drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
+      }
+      if (cornername & 0x2) {
+        d.drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
+        d.drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
+      }
+    }
+  }
+
+  // Bresenham's algorithm - thx wikpedia
+  static void drawLine(D &d, int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+   uint16_t color) {
+    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      _swap_int16_t(x0, y0);
+      _swap_int16_t(x1, y1);
+    }
+
+    if (x0 > x1) {
+      _swap_int16_t(x0, x1);
+      _swap_int16_t(y0, y1);
+    }
+
+    int16_t dx, dy;
+    dx = x1 - x0;
+    dy = abs(y1 - y0);
+
+    int16_t err = dx / 2;
+    int16_t ystep;
+
+    if (y0 < y1) {
+      ystep = 1;
+    } else {
+      ystep = -1;
+    }
+
+    for (; x0<=x1; x0++) {
+      if (steep) {
+        d.drawPixel(y0, x0, color);
+      } else {
+        d.drawPixel(x0, y0, color);
+      }
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  // Draw a rectangle
+  static void drawRect(D &d, int16_t x, int16_t y, int16_t w, int16_t h,
+   uint16_t color) {
+    d.drawFastHLine(x, y, w, color);
+    d.drawFastHLine(x, y+h-1, w, color);
+    d.drawFastVLine(x, y, h, color);
+    d.drawFastVLine(x+w-1, y, h, color);
+  }
+
+  static void fillRect(D &d, int16_t x, int16_t y, int16_t w, int16_t h,
+   uint16_t color) {
+    // Update in subclasses if desired!
+    for (int16_t i=x; i<x+w; i++) {
+      d.drawFastVLine(i, y, h, color);
+    }
+  }
+
+  static void fillScreen(D &d, uint16_t color) {
+    d.fillRect(0, 0, d._width, d._height, color);
+  }
+
+  // Draw a rounded rectangle
+  static void drawRoundRect(D &d, int16_t x, int16_t y, int16_t w,
+   int16_t h, int16_t r, uint16_t color) {
+    // smarter version
+    d.drawFastHLine(x+r  , y    , w-2*r, color); // Top
+    d.drawFastHLine(x+r  , y+h-1, w-2*r, color); // Bottom
+    d.drawFastVLine(x    , y+r  , h-2*r, color); // Left
+    d.drawFastVLine(x+w-1, y+r  , h-2*r, color); // Right
+    // draw four corners
+    drawCircleHelper(d, x+r    , y+r    , r, 1, color);
+    drawCircleHelper(d, x+w-r-1, y+r    , r, 2, color);
+    drawCircleHelper(d, x+w-r-1, y+h-r-1, r, 4, color);
+    drawCircleHelper(d, x+r    , y+h-r-1, r, 8, color);
+  }
+
+  // Fill a rounded rectangle
+  static void fillRoundRect(D &d, int16_t x, int16_t y, int16_t w,
+   int16_t h, int16_t r, uint16_t color) {
+    // smarter version
+    d.fillRect(x+r, y, w-2*r, h, color);
+
+    // draw four corners
+    fillCircleHelper(d, x+w-r-1, y+r, r, 1, h-2*r-1, color);
+    fillCircleHelper(d, x+r    , y+r, r, 2, h-2*r-1, color);
+  }
+
+  // Draw a triangle
+  static void drawTriangle(D &d, int16_t x0, int16_t y0,
+   int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    d.drawLine(x0, y0, x1, y1, color);
+    d.drawLine(x1, y1, x2, y2, color);
+    d.drawLine(x2, y2, x0, y0, color);
+  }
+
+  // Fill a triangle
+  static void fillTriangle(D &d, int16_t x0, int16_t y0,
+   int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+    HLineSpan span = { d, color };
+    Adafruit_GFX_triangleSpans(x0, y0, x1, y1, x2, y2, span);
+  }
+
+  // Receives the scanlines of fillTriangle()
+  struct HLineSpan {
+    D        &d;
+    uint16_t color;
+    void operator()(int16_t a, int16_t b, int16_t y) {
+      d.drawFastHLine(a, y, b-a+1, color);
+    }
+  };
+
+  // Draw a 1-bit image (bitmap) at the specified (x,y) position from the
+  // provided bitmap buffer (must be PROGMEM memory) using the specified
+  // foreground color (unset bits are transparent).
+  static void drawBitmap(D &d, int16_t x, int16_t y,
+   const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    uint8_t byte;
+
+    for(j=0; j<h; j++) {
+      for(i=0; i<w; i++) {
+        if(i & 7) byte <<= 1;
+        else      byte   = pgm_read_byte(bitmap + j * byteWidth + i / 8);
+        if(byte & 0x80) d.drawPixel(x+i, y+j, color);
+      }
+    }
+  }
+
+  // Draw a 1-bit image (bitmap) at the specified (x,y) position from the
+  // provided bitmap buffer (must be PROGMEM memory) using the specified
+  // foreground (for set bits) and background (for clear bits) colors.
+  static void drawBitmap(D &d, int16_t x, int16_t y,
+   const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    uint8_t byte;
+
+    for(j=0; j<h; j++) {
+      for(i=0; i<w; i++ ) {
+        if(i & 7) byte <<= 1;
+        else      byte   = pgm_read_byte(bitmap + j * byteWidth + i / 8);
+        if(byte & 0x80) d.drawPixel(x+i, y+j, color);
+        else            d.drawPixel(x+i, y+j, bg);
+      }
+    }
+  }
+
+  // drawBitmap() variant for RAM-resident (not PROGMEM) bitmaps.
+  static void drawBitmap(D &d, int16_t x, int16_t y,
+   uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    uint8_t byte;
+
+    for(j=0; j<h; j++) {
+      for(i=0; i<w; i++ ) {
+        if(i & 7) byte <<= 1;
+        else      byte   = bitmap[j * byteWidth + i / 8];
+        if(byte & 0x80) d.drawPixel(x+i, y+j, color);
+      }
+    }
+  }
+
+  // drawBitmap() variant w/background for RAM-resident (not PROGMEM) bitmaps.
+  static void drawBitmap(D &d, int16_t x, int16_t y,
+   uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    uint8_t byte;
+
+    for(j=0; j<h; j++) {
+      for(i=0; i<w; i++ ) {
+        if(i & 7) byte <<= 1;
+        else      byte   = bitmap[j * byteWidth + i / 8];
+        if(byte & 0x80) d.drawPixel(x+i, y+j, color);
+        else            d.drawPixel(x+i, y+j, bg);
+      }
+    }
+  }
+
+  //Draw XBitMap Files (*.xbm), exported from GIMP,
+  //Usage: Export from GIMP to *.xbm, rename *.xbm to *.c and open in editor.
+  //C Array can be directly used with this function
+  static void drawXBitmap(D &d, int16_t x, int16_t y,
+   const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+
+    int16_t i, j, byteWidth = (w + 7) / 8;
+    uint8_t byte;
+
+    for(j=0; j<h; j++) {
+      for(i=0; i<w; i++ ) {
+        if(i & 7) byte >>= 1;
+        else      byte   = pgm_read_byte(bitmap + j * byteWidth + i / 8);
+        if(byte & 0x01) d.drawPixel(x+i, y+j, color);
+      }
+    }
+  }
+
+  // Draw a character
+  static void drawChar(D &d, int16_t x, int16_t y, unsigned char c,
+   uint16_t color, uint16_t bg, uint8_t size) {
+
+    if(!d.gfxFont) { // 'Classic' built-in font
+
+      if((x >= d._width)          || // Clip right
+         (y >= d._height)         || // Clip bottom
+         ((x + 6 * size - 1) < 0) || // Clip left
+         ((y + 8 * size - 1) < 0))   // Clip top
+        return;
+
+      if(!d._cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+
+      for(int8_t i=0; i<6; i++ ) {
+        uint8_t line;
+        if(i < 5) line = pgm_read_byte(Adafruit_GFX::classicFont+(c*5)+i);
+        else      line = 0x0;
+        for(int8_t j=0; j<8; j++, line >>= 1) {
+          if(line & 0x1) {
+            if(size == 1) d.drawPixel(x+i, y+j, color);
+            else          d.fillRect(x+(i*size), y+(j*size), size, size, color);
+          } else if(bg != color) {
+            if(size == 1) d.drawPixel(x+i, y+j, bg);
+            else          d.fillRect(x+i*size, y+j*size, size, size, bg);
+          }
+        }
+      }
+
+    } else { // Custom font
+
+      // Character is assumed previously filtered by write() to eliminate
+      // newlines, returns, etc.  Codes the font has no glyph for draw nothing.
+
+      GFXglyph *glyph  = Adafruit_GFX_findGlyph(d.gfxFont, c);
+      if(!glyph) return;
+      uint8_t  *bitmap = (uint8_t *)pgm_read_pointer(&d.gfxFont->bitmap);
+
+      uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+      uint8_t  w  = pgm_read_byte(&glyph->width),
+               h  = pgm_read_byte(&glyph->height),
+               xa = pgm_read_byte(&glyph->xAdvance);
+      int8_t   xo = pgm_read_byte(&glyph->xOffset),
+               yo = pgm_read_byte(&glyph->yOffset);
+      uint8_t  xx, yy, bits, bit = 0;
+      int16_t  xo16, yo16;
+
+      if(size > 1) {
+        xo16 = xo;
+        yo16 = yo;
+      }
+
+      // Todo: Add character clipping here
+
+      // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
+      // THIS IS ON PURPOSE AND BY DESIGN.  The background color feature
+      // has typically been used with the 'classic' font to overwrite old
+      // screen contents with new data.  This ONLY works because the
+      // characters are a uniform size; it's not a sensible thing to do with
+      // proportionally-spaced fonts with glyphs of varying sizes (and that
+      // may overlap).  To replace previously-drawn text when using a custom
+      // font, use the getTextBounds() function to determine the smallest
+      // rectangle encompassing a string, erase the area with fillRect(),
+      // then draw new text.  This WILL infortunately 'blink' the text, but
+      // is unavoidable.  Drawing 'background' pixels will NOT fix this,
+      // only creates a new set of problems.  Have an idea to work around
+      // this (a canvas object type for MCUs that can afford the RAM and
+      // displays supporting setAddrWindow() and pushColors()), but haven't
+      // implemented this yet.
+
+      if(pgm_read_byte(&d.gfxFont->flags) & (GFXFONT_PAGES | GFXFONT_RLE)) {
+        // Column bytes, 8 rows at a time; only set bits cost anything,
+        // and an empty byte is a single test.
+        Adafruit_GFX_GlyphReader r;
+        r.start(d.gfxFont, glyph, c);
+        for(xx=0; xx<w; xx++) {
+          for(uint8_t page=0; page<(h+7)/8; page++) {
+            for(yy=page*8, bits=r.next(); bits; yy++, bits >>= 1) {
+              if(bits & 0x01) {
+                if(size == 1) {
+                  d.drawPixel(x+xo+xx, y+yo+yy, color);
+                } else {
+                  d.fillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
+                }
+              }
+            }
+          }
+        }
+        return;
+      }
+
+      for(yy=0; yy<h; yy++) {
+        for(xx=0; xx<w; xx++) {
+          if(!(bit++ & 7)) {
+            bits = pgm_read_byte(&bitmap[bo++]);
+          }
+          if(bits & 0x80) {
+            if(size == 1) {
+              d.drawPixel(x+xo+xx, y+yo+yy, color);
+            } else {
+              d.fillRect(x+(xo16+xx)*size, y+(yo16+yy)*size, size, size, color);
+            }
+          }
+          bits <<= 1;
+        }
+      }
+
+    } // End classic vs custom font
+  }
+
+  static void write(D &d, uint8_t c) {
+
+    if(!d.gfxFont) { // 'Classic' built-in font
+
+      if(c == '\n') {
+        d.cursor_y += d.textsize*8;
+        d.cursor_x  = 0;
+      } else if(c == '\r') {
+        // skip em
+      } else {
+        if(d.wrap && ((d.cursor_x + d.textsize * 6) >= d._width)) { // Heading off edge?
+          d.cursor_x  = 0;            // Reset x to zero
+          d.cursor_y += d.textsize * 8; // Advance y one line
+        }
+        d.drawChar(d.cursor_x, d.cursor_y, c, d.textcolor, d.textbgcolor, d.textsize);
+        d.cursor_x += d.textsize * 6;
+      }
+
+    } else { // Custom font
+
+      if(c == '\n') {
+        d.cursor_x  = 0;
+        d.cursor_y += (int16_t)d.textsize *
+                    (uint8_t)pgm_read_byte(&d.gfxFont->yAdvance);
+      } else if(c != '\r') {
+        GFXglyph *glyph = Adafruit_GFX_findGlyph(d.gfxFont, c);
+        if(glyph) {
+          uint8_t   w     = pgm_read_byte(&glyph->width),
+                    h     = pgm_read_byte(&glyph->height);
+          if((w > 0) && (h > 0)) { // Is there an associated bitmap?
+            int16_t xo = (int8_t)pgm_read_byte(&glyph->xOffset); // sic
+            if(d.wrap && ((d.cursor_x + d.textsize * (xo + w)) >= d._width)) {
+              // Drawing character would go off right edge; wrap to new line
+              d.cursor_x  = 0;
+              d.cursor_y += (int16_t)d.textsize *
+                          (uint8_t)pgm_read_byte(&d.gfxFont->yAdvance);
+            }
+            d.drawChar(d.cursor_x, d.cursor_y, c, d.textcolor, d.textbgcolor, d.textsize);
+          }
+          d.cursor_x += pgm_read_byte(&glyph->xAdvance) * (int16_t)d.textsize;
+        }
+      }
+
+    }
+  }
+};
+
+// CRTP base for displays that want the primitives specialized for their own
+// type: derive as  class MyDisplay final : public Adafruit_GFX_Fast<MyDisplay>
+// and define drawPixel(), drawFastVLine() and drawFastHLine().  Everything
+// else keeps the Adafruit_GFX interface, and the virtual overrides below
+// still serve callers holding an Adafruit_GFX pointer.
+template<class D> class Adafruit_GFX_Fast : public Adafruit_GFX {
+
+ public:
+
+  Adafruit_GFX_Fast(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+   uint16_t color) {
+    Adafruit_GFX_Core<D>::drawLine(self(), x0, y0, x1, y1, color);
+  }
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawRect(self(), x, y, w, h, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX_Core<D>::fillRect(self(), x, y, w, h, color);
+  }
+  void fillScreen(uint16_t color) {
+    Adafruit_GFX_Core<D>::fillScreen(self(), color);
+  }
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawCircle(self(), x0, y0, r, color);
+  }
+  void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+   uint16_t color) {
+    Adafruit_GFX_Core<D>::drawCircleHelper(self(), x0, y0, r, cornername, color);
+  }
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    Adafruit_GFX_Core<D>::fillCircle(self(), x0, y0, r, color);
+  }
+  void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername,
+   int16_t delta, uint16_t color) {
+    Adafruit_GFX_Core<D>::fillCircleHelper(self(), x0, y0, r, cornername,
+     delta, color);
+  }
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+   int16_t x2, int16_t y2, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawTriangle(self(), x0, y0, x1, y1, x2, y2, color);
+  }
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+   int16_t x2, int16_t y2, uint16_t color) {
+    Adafruit_GFX_Core<D>::fillTriangle(self(), x0, y0, x1, y1, x2, y2, color);
+  }
+  void drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+   int16_t radius, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawRoundRect(self(), x0, y0, w, h, radius, color);
+  }
+  void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+   int16_t radius, uint16_t color) {
+    Adafruit_GFX_Core<D>::fillRoundRect(self(), x0, y0, w, h, radius, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+   int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawBitmap(self(), x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+   int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    Adafruit_GFX_Core<D>::drawBitmap(self(), x, y, bitmap, w, h, color, bg);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+   int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawBitmap(self(), x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+   int16_t w, int16_t h, uint16_t color, uint16_t bg) {
+    Adafruit_GFX_Core<D>::drawBitmap(self(), x, y, bitmap, w, h, color, bg);
+  }
+  void drawXBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+   int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX_Core<D>::drawXBitmap(self(), x, y, bitmap, w, h, color);
+  }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+   uint16_t bg, uint8_t size) {
+    Adafruit_GFX_Core<D>::drawChar(self(), x, y, c, color, bg, size);
+  }
+
+#if ARDUINO >= 100
+  size_t write(uint8_t c) {
+    Adafruit_GFX_Core<D>::write(self(), c);
+    return 1;
+  }
+#else
+  void   write(uint8_t c) {
+    Adafruit_GFX_Core<D>::write(self(), c);
+  }
+#endif
+
+ private:
+  D &self(void) { return *static_cast<D *>(this); }
+};
+
+#endif // _ADAFRUIT_GFX_CORE_H
@@ -8,6 +8,22 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -p the glyphs are written in SSD1306 page order instead (GFXFONT_PAGES,
+see gfxfont.h) and the names get a 'p' suffix.  Such fonts draw fastest on
+the SSD1306, but take more flash: each glyph's last page is padded to 8
+rows.  -r writes the runs of blank and set pixels down each column instead
+(GFXFONT_RLE), suffix 'r': they take decoding as they are drawn, but from
+about 9pt up less flash than the default encoding (more below that).
+Either way each glyph keeps the box FreeType gives it:
+  ./fontconvert -r ~/Library/Fonts/FreeSans.ttf 9 > FreeSans9pt7br.h
+
+-c and -s keep only some of the glyphs, for fonts too big to carry whole:
+-c lists the characters, -s takes those in the string and character
+literals of a source file, and both may be given (more than once, too).
+The font then gets an index of the codes it holds (see gfxfont.h) and an
+'s' suffix on its names:
+  ./fontconvert -c 0123456789 -s pong.cpp FreeSans.ttf 24 > FreeSans24pt7bs.h
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -18,6 +34,8 @@ See notes at end for glyph nomenclature & other tidbits.
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
 #include <ft2build.h>
@@ -26,29 +44,127 @@ See notes at end for glyph nomenclature & other tidbits.
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Hexadecimal byte write, a dozen to a line
+void enbyte(uint8_t sum) {
+	static uint8_t row = 0, firstCall = 1;
+	if(!firstCall) { // Format output table nicely
+		if(++row >= 12) {        // Last entry on line?
+			printf(",\n  "); //   Newline format output
+			row = 0;         //   Reset row counter
+		} else {                 // Not end of line
+			printf(", ");    //   Simple comma delim
+		}
+	}
+	printf("0x%02X", sum); // Write byte value
+	firstCall = 0;         // Formatting flag
+}
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
-	static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+	static uint8_t sum = 0, bit = 0x80;
 	if(value) sum |= bit;    // Set bit if needed
 	if(!(bit >>= 1)) {       // Advance to next bit, end of byte reached?
-		if(!firstCall) { // Format output table nicely
-			if(++row >= 12) {        // Last entry on line?
-				printf(",\n  "); //   Newline format output
-				row = 0;         //   Reset row counter
-			} else {                 // Not end of line
-				printf(", ");    //   Simple comma delim
+		enbyte(sum);     // Write byte value
+		sum = 0;         // Clear for next byte
+		bit = 0x80;      // Reset bit counter
+	}
+}
+
+// Accumulate 4-bit codes for output, high nibble first; a negative code
+// flushes a half-filled byte, padded with a zero code
+void ennibble(int code) {
+	static uint8_t sum = 0, half = 0;
+	if(code < 0) {
+		if(half) enbyte(sum);
+		half = 0;
+		return;
+	}
+	if(half) {
+		enbyte(sum | code);
+	} else {
+		sum = code << 4;
+	}
+	half = !half;
+}
+
+// Write a glyph's pixels, n of them down each column in turn, as
+// GFXFONT_RLE runs, returning the bytes written.  A trailing blank run is
+// left out unless this is the last glyph, the next glyph's offset ends it.
+int enrle(const uint8_t *pixels, int n, int last) {
+	int i, run = 0, set = 0, codes = 0;
+	for(i=0; i<=n; i++) {
+		if((i < n) && (pixels[i] == set)) {
+			run++;
+			continue;
+		}
+		if((i == n) && !set && !last) break;
+		for(; run >= 15; run -= 15, codes++) ennibble(15);
+		ennibble(run);
+		codes++;
+		set = !set;
+		run = 1;
+	}
+	ennibble(-1);
+	return (codes + 1) / 2;
+}
+
+// Mark the characters in the string and character literals of a C or
+// C++ source file, comments skipped.  An escape marks the character it
+// stands for when that is a quote or backslash, and nothing otherwise.
+int scanliterals(const char *filename, uint8_t *subset) {
+	enum { CODE, STRING, CHAR, LINE_COMMENT, BLOCK_COMMENT } state = CODE;
+	int   c, prev = 0;
+	FILE *f;
+
+	if(!(f = fopen(filename, "r"))) {
+		fprintf(stderr, "Can't open %s\n", filename);
+		return 1;
+	}
+	while((c = getc(f)) != EOF) {
+		switch(state) {
+		  case CODE:
+			if(c == '"')                      state = STRING;
+			else if(c == '\'')                state = CHAR;
+			else if((c == '/') && (prev == '/')) state = LINE_COMMENT;
+			else if((c == '*') && (prev == '/')) state = BLOCK_COMMENT;
+			else break;
+			c = 0; // Don't let the opening count as the close
+			break;
+		  case STRING:
+		  case CHAR:
+			if(c == '\\') {
+				c = getc(f);
+				if((c == '\\') || (c == '"') || (c == '\'')) {
+					subset[c] = 1;
+				}
+				c = 0;
+			} else if(c == ((state == STRING) ? '"' : '\'')) {
+				state = CODE;
+				c     = 0;
+			} else if((c >= ' ') && (c < 256)) {
+				subset[c] = 1;
+			}
+			break;
+		  case LINE_COMMENT:
+			if(c == '\n') state = CODE;
+			break;
+		  case BLOCK_COMMENT:
+			if((c == '/') && (prev == '*')) {
+				state = CODE;
+				c     = 0;
 			}
+			break;
 		}
-		printf("0x%02X", sum); // Write byte value
-		sum       = 0;         // Clear for next byte
-		bit       = 0x80;      // Reset bit counter
-		firstCall = 0;         // Formatting flag
+		prev = c;
 	}
+	fclose(f);
+	return 0;
 }
 
 int main(int argc, char *argv[]) {
 	int                i, j, err, size, first=' ', last='~',
-	                   bitmapOffset = 0, x, y, byte;
+	                   bitmapOffset = 0, x, y, byte, flags = 0,
+	                   w, h, pages, sparse = 0, count = 0, skip;
 	char              *fontName, c, *ptr;
 	FT_Library         library;
 	FT_Face            face;
@@ -56,18 +172,42 @@ int main(int argc, char *argv[]) {
 	FT_Bitmap         *bitmap;
 	FT_BitmapGlyphRec *g;
 	GFXglyph          *table;
-	uint8_t            bit;
+	uint8_t            bit, *columns, subset[256];
 
 	// Parse command line.  Valid syntaxes are:
-	//   fontconvert [filename] [size]
-	//   fontconvert [filename] [size] [last char]
-	//   fontconvert [filename] [size] [first char] [last char]
+	//   fontconvert [options] [filename] [size]
+	//   fontconvert [options] [filename] [size] [last char]
+	//   fontconvert [options] [filename] [size] [first char] [last char]
 	// Unless overridden, default first and last chars are
-	// ' ' (space) and '~', respectively
+	// ' ' (space) and '~', respectively.  Options are -p or -r, and
+	// any number of -c [chars] and -s [source file].
+
+	memset(subset, 0, sizeof(subset));
+	while((argc > 1) && (argv[1][0] == '-')) {
+		skip = 1;
+		if(!strcmp(argv[1], "-p")) {
+			flags = GFXFONT_PAGES;
+		} else if(!strcmp(argv[1], "-r")) {
+			flags = GFXFONT_RLE;
+		} else if(!strcmp(argv[1], "-c") && (argc > 2)) {
+			for(ptr=argv[2]; *ptr; ptr++) subset[(uint8_t)*ptr] = 1;
+			sparse = skip = 2;
+		} else if(!strcmp(argv[1], "-s") && (argc > 2)) {
+			if(scanliterals(argv[2], subset)) return 1;
+			sparse = skip = 2;
+		} else {
+			argc = 0; // Unknown option, show usage
+			break;
+		}
+		// Drop the option, the rest are positional
+		argv[skip] = argv[0];
+		argv      += skip;
+		argc      -= skip;
+	}
 
 	if(argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
-		  argv[0]);
+		fprintf(stderr, "Usage: %s [-p|-r] [-c chars] [-s source] "
+		  "fontfile size [first] [last]\n", argv[0]);
 		return 1;
 	}
 
@@ -86,6 +226,22 @@ int main(int argc, char *argv[]) {
 		last  = i;
 	}
 
+	// Narrow first and last to the subset, if any, otherwise take the
+	// whole range.  Either way subset marks the chars to convert.
+	for(i=0; i<256; i++) {
+		if((i < first) || (i > last)) subset[i] = 0;
+		else if(!sparse)              subset[i] = 1;
+	}
+	for(i=0; (i<256) && !subset[i]; i++);
+	for(j=255; (j>=0) && !subset[j]; j--);
+	if(j < i) {
+		fprintf(stderr, "No characters to convert\n");
+		return 1;
+	}
+	first = i;
+	last  = j;
+	for(i=first; i<=last; i++) count += subset[i];
+
 	ptr = strrchr(argv[1], '/'); // Find last slash in filename
 	if(ptr) ptr++;         // First character of filename (path stripped)
 	else    ptr = argv[1]; // No path; font in local dir.
@@ -105,7 +261,8 @@ int main(int argc, char *argv[]) {
 	if(!ptr) ptr = &fontName[strlen(fontName)]; // If none, append
 	// Insert font size and 7/8 bit.  fontName was alloc'd w/extra
 	// space to allow this, we're not sprintfing into Forbidden Zone.
-	sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+	sprintf(ptr, "%dpt%db%s%s", size, (last > 127) ? 8 : 7,
+	  (flags & GFXFONT_RLE) ? "r" : flags ? "p" : "", sparse ? "s" : "");
 	// Space and punctuation chars in name replaced w/ underscores.  
 	for(i=0; (c=fontName[i]); i++) {
 		if(isspace(c) || ispunct(c)) fontName[i] = '_';
@@ -125,16 +282,19 @@ int main(int argc, char *argv[]) {
 	// << 6 because '26dot6' fixed-point format
 	FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
 
-	// Currently all symbols from 'first' to 'last' are processed.
-	// Fonts may contain WAY more glyphs than that, but this code
-	// will need to handle encoding stuff to deal with extracting
-	// the right symbols, and that's not done yet.
+	// Currently the symbols from 'first' to 'last' are processed (or
+	// the subset of them asked for).  Fonts may contain WAY more glyphs
+	// than that, but this code will need to handle encoding stuff to
+	// deal with extracting the right symbols, and that's not done yet.
 	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
 	printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
 
 	// Process glyphs and output huge bitmap data array
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(i=first, j=-1; i<=last; i++) {
+		if(!subset[i]) continue;
+		j++;
+
 		// MONO renderer provides clean image with perfect crop
 		// (no wasted pixels) via bitmap struct.
 		if((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
@@ -174,6 +334,37 @@ int main(int argc, char *argv[]) {
 		table[j].xOffset      = g->left;
 		table[j].yOffset      = 1 - g->top;
 
+		if(flags) {
+			// Column bytes for page order, or a pixel per byte down
+			// each column for the runs, in the glyph's own box
+			w     = bitmap->width;
+			h     = bitmap->rows;
+			pages = (h + 7) / 8;
+			if(!(columns = calloc(pages * w + w * h + 1, 1))) {
+				fprintf(stderr, "Malloc error\n");
+				return 1;
+			}
+			for(y=0; y < h; y++) {
+				for(x=0; x < w; x++) {
+					if(bitmap->buffer[y * bitmap->pitch + x / 8] &
+					  (0x80 >> (x & 7))) {
+						columns[(y / 8) * w + x] |= 1 << (y & 7);
+						columns[pages * w + x * h + y] = 1;
+					}
+				}
+			}
+			if(flags & GFXFONT_RLE) {
+				bitmapOffset += enrle(&columns[pages * w], w * h,
+				  i == last);
+			} else {
+				for(x=0; x < pages * w; x++) enbyte(columns[x]);
+				bitmapOffset += pages * w;
+			}
+			free(columns);
+			FT_Done_Glyph(glyph);
+			continue;
+		}
+
 		for(y=0; y < bitmap->rows; y++) {
 			for(x=0;x < bitmap->width; x++) {
 				byte = x / 8;
@@ -198,7 +389,9 @@ int main(int argc, char *argv[]) {
 
 	// Output glyph attributes table (one per character)
 	printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
-	for(i=first, j=0; i<=last; i++, j++) {
+	for(i=first, j=-1; i<=last; i++) {
+		if(!subset[i]) continue;
+		j++;
 		printf("  { %5d, %3d, %3d, %3d, %4d, %4d }",
 		  table[j].bitmapOffset,
 		  table[j].width,
@@ -218,14 +411,31 @@ int main(int argc, char *argv[]) {
 	if((last >= ' ') && (last <= '~')) printf(" '%c'", last);
 	printf("\n\n");
 
+	// Output the codes of a subset, matching the glyph table
+	if(sparse) {
+		printf("const uint8_t %sIndex[] PROGMEM = {\n  ", fontName);
+		for(i=first, j=0; i<=last; i++) {
+			if(!subset[i]) continue;
+			if(j) printf((j % 12) ? ", " : ",\n  ");
+			printf("0x%02X", i);
+			j++;
+		}
+		printf(" };\n\n");
+	}
+
 	// Output font structure
 	printf("const GFXfont %s PROGMEM = {\n", fontName);
 	printf("  (uint8_t  *)%sBitmaps,\n", fontName);
 	printf("  (GFXglyph *)%sGlyphs,\n", fontName);
-	printf("  0x%02X, 0x%02X, %ld };\n\n",
+	printf("  0x%02X, 0x%02X, %ld",
 	  first, last, face->size->metrics.height >> 6);
+	if(flags & GFXFONT_RLE) printf(", GFXFONT_RLE");
+	else if(flags)          printf(", GFXFONT_PAGES");
+	else if(sparse)         printf(", 0");
+	if(sparse) printf(",\n  (uint8_t  *)%sIndex", fontName);
+	printf(" };\n\n");
 	printf("// Approx. %d bytes\n",
-	  bitmapOffset + (last - first + 1) * 7 + 7);
+	  bitmapOffset + count * (sparse ? 8 : 7) + 10);
 	// Size estimate is based on AVR struct and pointer sizes;
 	// actual size may vary.
 
@@ -19,6 +19,27 @@ typedef struct { // Data stored for FONT AS A WHOLE:
 	GFXglyph *glyph;       // Glyph array
 	uint8_t   first, last; // ASCII extents
 	uint8_t   yAdvance;    // Newline distance (y axis)
+	uint8_t   flags;       // GFXFONT_* bitmap encoding, 0 if left out
+	uint8_t  *index;       // Codes of a glyph subset, NULL if left out
 } GFXfont;
 
+// A font with an index holds glyphs only for the codes listed in it, in
+// ascending order (first is the first entry, last the final one), the
+// glyph array matching it entry for entry.  Without one, every code from
+// first to last has a glyph.
+
+// GFXfont flags.  Fonts that don't set any keep the original encoding:
+// each glyph row-major, a bit per pixel, MSB first, padded to a byte.
+// GFXFONT_PAGES glyphs are stored the way the SSD1306 holds its buffer:
+// a byte per column for each 8 rows, bit 0 at the top, page after page.
+// Quick to draw, but the last page of each glyph is padded to 8 rows.
+// GFXFONT_RLE glyphs are the runs of blank and set pixels going down each
+// column in turn, left to right, starting with a blank run (maybe empty)
+// and alternating.  A run is coded in 4-bit codes, high nibble first, as
+// the sum of its codes up to the first one below 15.  The runs of a glyph
+// end where the next glyph's begin, the rest of it blank (the last glyph's
+// runs cover all of it), and each glyph starts on a byte.
+#define GFXFONT_PAGES 0x01
+#define GFXFONT_RLE   0x02
+
 #endif // _GFXFONT_H_
@@ -33,9 +33,44 @@ All text above, and the splash screen below must be included in any redistributi
 #include "Adafruit_GFX.h"
 #include "Adafruit_SSD1306.h"
 
+// most commands an I2C transmission can carry after its control byte
+#if defined(BUFFER_LENGTH)
+ #define SSD1306_WIRE_MAX (BUFFER_LENGTH-1)
+#else
+ #define SSD1306_WIRE_MAX 31
+#endif
+
+#ifdef SSD1306_TWI_DIRECT
+ #include <avr/interrupt.h>
+ #include <util/twi.h>
+#endif
+
+#ifdef SSD1306_SHADOW_FRAME
+#ifdef __AVR__
+ #include <util/crc16.h>
+ #define ssd1306_crc_update _crc_ccitt_update
+#else
+// same as _crc_ccitt_update() from avr-libc
+static inline uint16_t ssd1306_crc_update(uint16_t crc, uint8_t data) {
+  data ^= (crc & 0xFF);
+  data ^= data << 4;
+  return ((((uint16_t)data << 8) | (crc >> 8)) ^ (uint8_t)(data >> 4) ^ ((uint16_t)data << 3));
+}
+#endif
+#endif
+
 // the memory buffer for the LCD
 
+#ifdef SSD1306_PAGE_BUFFER
+// only the page being drawn, see firstPage()
+static uint8_t buffer[SSD1306_LCDWIDTH];
+static uint8_t band;
+#else
+#ifdef SSD1306_DOUBLE_BUFFER
+static uint8_t frame0[SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8] = {
+#else
 static uint8_t buffer[SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8] = {
+#endif
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -105,16 +140,256 @@ static uint8_t buffer[SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8] = {
 #endif
 #endif
 };
+#endif
+
+#ifdef SSD1306_DOUBLE_BUFFER
+// drawing goes to buffer, flushes read frontBuffer; display() swaps them
+static uint8_t frame1[SSD1306_LCDHEIGHT * SSD1306_LCDWIDTH / 8];
+static uint8_t *buffer = frame0;
+static uint8_t *frontBuffer = frame1;
+#else
+static uint8_t * const frontBuffer = buffer;
+#endif
+
+// where page p of the panel lives in the buffer
+#ifdef SSD1306_PAGE_BUFFER
+ #define SSD1306_BUFFER_SIZE SSD1306_LCDWIDTH
+ #define BUFFER_PAGE(p) 0
+#else
+ #define SSD1306_BUFFER_SIZE (SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8)
+ #define BUFFER_PAGE(p) (p)
+#endif
+
+#ifdef SSD1306_SHADOW_FRAME
+// CRC of every chunk as it was last sent to the panel
+static uint16_t shadow[SSD1306_CHUNKS];
+#endif
+
+// Init sequence, sent as one command list by begin()
+#define SSD1306_INIT_SEQUENCE(chargepump, contrast, precharge) {        \
+  SSD1306_DISPLAYOFF,                       /* 0xAE */                  \
+  SSD1306_SETDISPLAYCLOCKDIV, 0x80,         /* 0xD5, suggested ratio */ \
+  SSD1306_SETMULTIPLEX, SSD1306_LCDHEIGHT - 1, /* 0xA8 */               \
+  SSD1306_SETDISPLAYOFFSET, 0x0,            /* 0xD3, no offset */       \
+  SSD1306_SETSTARTLINE | 0x0,               /* line #0 */               \
+  SSD1306_CHARGEPUMP, chargepump,           /* 0x8D */                  \
+  SSD1306_MEMORYMODE, 0x00,                 /* 0x20, act like ks0108 */ \
+  SSD1306_SEGREMAP | 0x1,                                               \
+  SSD1306_COMSCANDEC,                                                   \
+  SSD1306_SETCOMPINS, SSD1306_COMPINS,      /* 0xDA */                  \
+  SSD1306_SETCONTRAST, contrast,            /* 0x81 */                  \
+  SSD1306_SETPRECHARGE, precharge,          /* 0xD9 */                  \
+  SSD1306_SETVCOMDETECT, 0x40,              /* 0xDB */                  \
+  SSD1306_DISPLAYALLON_RESUME,              /* 0xA4 */                  \
+  SSD1306_NORMALDISPLAY,                    /* 0xA6 */                  \
+  SSD1306_DEACTIVATE_SCROLL,                                            \
+  SSD1306_DISPLAYON                         /* turn on oled panel */    \
+}
+
+static const uint8_t PROGMEM init_externalvcc[] =
+  SSD1306_INIT_SEQUENCE(0x10, SSD1306_CONTRAST_EXTERNALVCC, 0x22);
+static const uint8_t PROGMEM init_switchcapvcc[] =
+  SSD1306_INIT_SEQUENCE(0x14, SSD1306_CONTRAST_SWITCHCAPVCC, 0xF1);
+
+// The flush in progress: the window snapshot taken by prepareFlush() and
+// the window nextWindow() has handed out last.  Shared by display() and
+// the TWI interrupt.
+static uint8_t flushX0, flushX1, flushPage, flushPage1;
+static uint8_t winX0, winX1, winPage0, winPage1;
+#ifdef SSD1306_SHADOW_FRAME
+static uint8_t flushChunk;
+static uint8_t changed[(SSD1306_CHUNKS+7)/8]; // one bit per chunk to send
+#endif
+
+// step to the next window of the flush to send, false once it is done
+static boolean nextWindow(void) {
+#ifdef SSD1306_SHADOW_FRAME
+  // one window per run of changed chunks within a page
+  uint8_t chunk1 = flushX1 / SSD1306_CHUNK_SIZE;
+
+  while (flushPage <= flushPage1) {
+    uint8_t index = flushPage*SSD1306_CHUNKS_PER_PAGE;
+    while ((flushChunk <= chunk1) && !(changed[(index+flushChunk)/8] & (1 << ((index+flushChunk)&7)))) {
+      flushChunk++;
+    }
+
+    if (flushChunk <= chunk1) {
+      uint8_t start = flushChunk;
+      while ((flushChunk <= chunk1) && (changed[(index+flushChunk)/8] & (1 << ((index+flushChunk)&7)))) {
+        flushChunk++;
+      }
+      // the window may start or end inside a chunk, the rest of which is already current
+      winX0 = (start*SSD1306_CHUNK_SIZE > flushX0) ? start*SSD1306_CHUNK_SIZE : flushX0;
+      winX1 = (flushChunk <= chunk1) ? flushChunk*SSD1306_CHUNK_SIZE-1 : flushX1;
+      winPage0 = winPage1 = flushPage;
+      return true;
+    }
+
+    flushPage++;
+    flushChunk = flushX0 / SSD1306_CHUNK_SIZE;
+  }
+  return false;
+#else
+  if (flushPage > flushPage1) {
+    return false;
+  }
+  winX0 = flushX0;
+  winX1 = flushX1;
+  winPage0 = flushPage;
+  winPage1 = flushPage1;
+  flushPage = flushPage1 + 1;
+  return true;
+#endif
+}
+
+#ifdef SSD1306_TWI_DIRECT
+// set when a transfer is abandoned, polled or from the interrupt; the
+// panel may then hold anything, so the next flush sends all of it
+static volatile boolean twiFailed = false;
+#endif
+
+#ifdef SSD1306_TWI_ASYNC
+// Interrupt driven flush.  Each window goes out as one transaction: the
+// addressing commands, each behind a Co=1 control byte, then a 0x40
+// control byte and the window's data.
+static volatile boolean twiBusy = false;
+static uint8_t twiAddr;
+static uint8_t twiHeader[13] = {
+  0x80, SSD1306_COLUMNADDR, 0x80, 0, 0x80, 0,
+  0x80, SSD1306_PAGEADDR, 0x80, 0, 0x80, 0,
+  0x40
+};
+static uint8_t twiHeaderIdx;
+static const uint8_t *twiData;
+static uint8_t twiCols, twiColsLeft;
+static uint16_t twiRemaining;
+
+static void twiLoadWindow(void) {
+  twiHeader[3] = winX0;
+  twiHeader[5] = winX1;
+  twiHeader[9] = winPage0;
+  twiHeader[11] = winPage1;
+  twiHeaderIdx = 0;
+  twiData = &frontBuffer[winPage0*SSD1306_LCDWIDTH + winX0];
+  twiCols = twiColsLeft = winX1 - winX0 + 1;
+  twiRemaining = (uint16_t)twiCols * (winPage1 - winPage0 + 1);
+}
+
+ISR(TWI_vect) {
+  switch (TW_STATUS) {
+  case TW_START:
+  case TW_REP_START:
+    TWDR = twiAddr << 1; // SLA+W
+    break;
+
+  case TW_MT_SLA_ACK:
+  case TW_MT_DATA_ACK:
+    if (twiHeaderIdx < sizeof(twiHeader)) {
+      TWDR = twiHeader[twiHeaderIdx++];
+    } else if (twiRemaining) {
+      TWDR = *twiData++;
+      twiRemaining--;
+      if (--twiColsLeft == 0) {
+        // wrap to the start of the window on the next page
+        twiData += SSD1306_LCDWIDTH - twiCols;
+        twiColsLeft = twiCols;
+      }
+    } else if (nextWindow()) {
+      twiLoadWindow();
+      TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE); // STOP, then START
+      return;
+    } else {
+      TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);
+      twiBusy = false;
+      return;
+    }
+    break;
+
+  default:
+    // NACK or lost arbitration, give up on this flush
+    TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);
+    twiFailed = true;
+    twiBusy = false;
+    return;
+  }
+  TWCR = _BV(TWINT) | _BV(TWEN) | _BV(TWIE);
+}
+#endif
+
+#if defined SSD1306_SHADOW_FRAME && defined SSD1306_TWI_ASYNC && !defined SSD1306_DOUBLE_BUFFER
+// What was drawn between displayAsync() and the waitFlush() after it.  It
+// may have gone out half drawn, and then been drawn back to what its CRC
+// says was sent, so its chunks are sent again whatever their CRC.
+#define SSD1306_TOUCHED_WINDOW
+static boolean flushOpen;
+static uint8_t touchedX0 = 0xFF, touchedX1, touchedPage0 = 0xFF, touchedPage1;
+#endif
+
+#ifdef SSD1306_TWI_DIRECT
+// polled transfers
+static void twiWait(void) {
+  while (!(TWCR & _BV(TWINT))) {
+  }
+}
+
+static void twiStop(void) {
+  TWCR = _BV(TWINT) | _BV(TWSTO) | _BV(TWEN);
+  while (TWCR & _BV(TWSTO)) {
+  }
+}
+
+// true if the last step ended in status; otherwise, as on a NACK or lost
+// arbitration, give up on the transaction
+static boolean twiCheck(uint8_t status) {
+  if (TW_STATUS == status) {
+    return true;
+  }
+  twiStop();
+  twiFailed = true;
+  return false;
+}
+
+static boolean twiWrite(uint8_t data) {
+  TWDR = data;
+  TWCR = _BV(TWINT) | _BV(TWEN);
+  twiWait();
+  return twiCheck(TW_MT_DATA_ACK);
+}
+
+static boolean twiStart(uint8_t addr) {
+  TWCR = _BV(TWINT) | _BV(TWSTA) | _BV(TWEN);
+  twiWait();
+  if (!twiCheck(TW_START)) {
+    return false;
+  }
+  TWDR = addr << 1; // SLA+W
+  TWCR = _BV(TWINT) | _BV(TWEN);
+  twiWait();
+  return twiCheck(TW_MT_SLA_ACK);
+}
+#endif
 
 #define ssd1306_swap(a, b) { int16_t t = a; a = b; b = t; }
 
+// the rotation and rotated size the drawing routines work with, constants
+// under SSD1306_ROTATION so the switches on them fold away
+#ifdef SSD1306_ROTATION
+  #define DRAW_ROTATION (SSD1306_ROTATION & 3)
+  #define DRAW_WIDTH ((DRAW_ROTATION & 1) ? SSD1306_LCDHEIGHT : SSD1306_LCDWIDTH)
+  #define DRAW_HEIGHT ((DRAW_ROTATION & 1) ? SSD1306_LCDWIDTH : SSD1306_LCDHEIGHT)
+#else
+  #define DRAW_ROTATION rotation
+  #define DRAW_WIDTH _width
+  #define DRAW_HEIGHT _height
+#endif
+
 // the most basic function, set a single pixel
 void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+  if ((x < 0) || (x >= DRAW_WIDTH) || (y < 0) || (y >= DRAW_HEIGHT))
     return;
 
   // check rotation, move pixel around if necessary
-  switch (getRotation()) {
+  switch (DRAW_ROTATION) {
   case 1:
     ssd1306_swap(x, y);
     x = WIDTH - x - 1;
@@ -129,38 +404,314 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
     break;
   }
 
+#ifdef SSD1306_PAGE_BUFFER
+  if ((y/8) != band)
+    return;
+#endif
+
+  markDirty(x, x, y/8, y/8);
+
   // x is which column
     switch (color)
     {
-      case WHITE:   buffer[x+ (y/8)*SSD1306_LCDWIDTH] |=  (1 << (y&7)); break;
-      case BLACK:   buffer[x+ (y/8)*SSD1306_LCDWIDTH] &= ~(1 << (y&7)); break;
-      case INVERSE: buffer[x+ (y/8)*SSD1306_LCDWIDTH] ^=  (1 << (y&7)); break;
+      case WHITE:   buffer[x+ BUFFER_PAGE(y/8)*SSD1306_LCDWIDTH] |=  (1 << (y&7)); break;
+      case BLACK:   buffer[x+ BUFFER_PAGE(y/8)*SSD1306_LCDWIDTH] &= ~(1 << (y&7)); break;
+      case INVERSE: buffer[x+ BUFFER_PAGE(y/8)*SSD1306_LCDWIDTH] ^=  (1 << (y&7)); break;
+    }
+
+}
+
+// whether page p is on the panel (and, with SSD1306_PAGE_BUFFER, in the buffer)
+static inline boolean pageInBuffer(int8_t p) {
+#ifdef SSD1306_PAGE_BUFFER
+  return p == band;
+#else
+  return (p >= 0) && (p < SSD1306_LCDHEIGHT/8);
+#endif
+}
+
+// combine one sprite byte into the buffer
+static inline void blitByte(uint8_t *pBuf, uint8_t bits, uint16_t color) {
+  switch (color)
+  {
+  case WHITE:   *pBuf |=  bits; break;
+  case BLACK:   *pBuf &= ~bits; break;
+  case INVERSE: *pBuf ^=  bits; break;
+  }
+}
+
+#ifdef SSD1306_SPRITE_CACHE
+// combine a row of n bytes from RAM into the buffer
+static void blitRow(uint8_t *pBuf, const uint8_t *src, uint8_t n, uint16_t color) {
+  switch (color)
+  {
+  case WHITE:   while (n--) { *pBuf++ |=  *src++; } break;
+  case BLACK:   while (n--) { *pBuf++ &= ~*src++; } break;
+  case INVERSE: while (n--) { *pBuf++ ^=  *src++; } break;
+  }
+}
+
+// Sprites drawSprite() has seen, each kept in the arena shifted down by
+// every row offset 0..7: 8 copies of pages+1 pages of w bytes.
+typedef struct {
+  const uint8_t *sprite;
+  uint8_t w, h;
+  uint16_t start;
+} cachedSprite;
+
+static uint8_t spriteArena[SSD1306_SPRITE_CACHE];
+static uint16_t spriteArenaUsed;
+static cachedSprite spriteCache[SSD1306_SPRITE_CACHE_ENTRIES];
+static uint8_t spriteCacheUsed;
+
+// the shifted copies of a sprite, made on first use; NULL if they do not fit
+static const uint8_t *shiftedSprite(const uint8_t *sprite, uint8_t w, uint8_t h) {
+  for (uint8_t i=0; i<spriteCacheUsed; i++) {
+    cachedSprite *c = &spriteCache[i];
+    if ((c->sprite == sprite) && (c->w == w) && (c->h == h)) {
+      return &spriteArena[c->start];
+    }
+  }
+
+  uint8_t pages = (h + 7) / 8;
+  uint16_t size = 8 * (uint16_t)w * (pages + 1);
+  if ((spriteCacheUsed == SSD1306_SPRITE_CACHE_ENTRIES) || (size > SSD1306_SPRITE_CACHE - spriteArenaUsed)) {
+    return NULL;
+  }
+
+  uint8_t *dst = &spriteArena[spriteArenaUsed];
+  for (uint8_t shift=0; shift<8; shift++) {
+    for (uint8_t p=0; p<=pages; p++) {
+      for (uint8_t i=0; i<w; i++) {
+        // bottom of this page's bits plus the top of the page above's
+        uint8_t bits = (p < pages) ? (pgm_read_byte(&sprite[p*w + i]) << shift) : 0;
+        if (p && shift) {
+          bits |= pgm_read_byte(&sprite[(p-1)*w + i]) >> (8 - shift);
+        }
+        *dst++ = bits;
+      }
+    }
+  }
+
+  cachedSprite *c = &spriteCache[spriteCacheUsed++];
+  c->sprite = sprite;
+  c->w = w;
+  c->h = h;
+  c->start = spriteArenaUsed;
+  spriteArenaUsed += size;
+  return &spriteArena[c->start];
+}
+#endif
+
+// draw a sprite stored in PROGMEM in the panel's own format, a whole byte
+// per column for each group of 8 rows, shifted into at most two pages
+void Adafruit_SSD1306::drawSprite(int16_t x, int16_t y, const uint8_t *sprite, uint8_t w, uint8_t h, uint16_t color) {
+  uint8_t pages = (h + 7) / 8;
+
+  if (DRAW_ROTATION != 0) {
+    // the fast path only knows the panel's own orientation
+    for (uint8_t j=0; j<h; j++) {
+      for (uint8_t i=0; i<w; i++) {
+        if (pgm_read_byte(&sprite[(j/8)*w + i]) & (1 << (j&7))) {
+          drawPixel(x+i, y+j, color);
+        }
+      }
+    }
+    return;
+  }
+
+  // clip to the columns on the panel
+  int16_t i0 = 0, i1 = w;
+  if (x < 0) {
+    i0 = -x;
+  }
+  if ((x + i1) > WIDTH) {
+    i1 = WIDTH - x;
+  }
+  if ((i0 >= i1) || (y >= HEIGHT) || ((y + h) <= 0)) {
+    return;
+  }
+
+  int8_t page0 = y >> 3; // rounds down for rows above the panel too
+  uint8_t shift = y & 7;
+
+  int8_t last = page0 + pages - (shift ? 0 : 1);
+  markDirty(x+i0, x+i1-1, (page0 < 0) ? 0 : page0,
+            (last >= SSD1306_LCDHEIGHT/8) ? SSD1306_LCDHEIGHT/8-1 : last);
+
+#ifdef SSD1306_SPRITE_CACHE
+  // already shifted into whole pages, each row is a plain combine
+  const uint8_t *shifted = shiftedSprite(sprite, w, h);
+  if (shifted) {
+    shifted += shift * w * (pages + 1);
+    for (uint8_t p=0; p<=pages; p++) {
+      int8_t dst = page0 + p;
+      if (pageInBuffer(dst)) {
+        blitRow(&buffer[BUFFER_PAGE(dst)*SSD1306_LCDWIDTH + x + i0], &shifted[p*w + i0], i1 - i0, color);
+      }
+    }
+    return;
+  }
+#endif
+
+  for (uint8_t p=0; p<pages; p++) {
+    const uint8_t *src = &sprite[p*w + i0];
+    int8_t dst = page0 + p;
+
+    // top part of each byte lands in page dst, the rest in the page below
+    uint8_t *pLo = pageInBuffer(dst) ? &buffer[BUFFER_PAGE(dst)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    uint8_t *pHi = (shift && pageInBuffer(dst+1)) ? &buffer[BUFFER_PAGE(dst+1)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    if (!pLo && !pHi) {
+      continue;
+    }
+
+    for (int16_t i=i0; i<i1; i++) {
+      uint16_t bits = pgm_read_byte(src++) << shift;
+      if (pLo) {
+        blitByte(pLo++, bits, color);
+      }
+      if (pHi) {
+        blitByte(pHi++, bits >> 8, color);
+      }
+    }
+  }
+}
+
+// combine one bitmap byte into the buffer, touching only the rows in mask
+static inline void ropByte(uint8_t *pBuf, uint8_t bits, uint8_t mask, uint8_t op) {
+  switch (op)
+  {
+  case SSD1306_COPY: *pBuf = (*pBuf & ~mask) | (bits & mask); break;
+  case SSD1306_OR:   *pBuf |= bits & mask; break;
+  case SSD1306_AND:  *pBuf &= bits | ~mask; break;
+  case SSD1306_XOR:  *pBuf ^= bits & mask; break;
+  }
+}
+
+// like drawSprite(), but every row of the rectangle is combined with the
+// raster op, so the mask of the rows each page covers goes along with it
+void Adafruit_SSD1306::drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t op) {
+  uint8_t pages = (h + 7) / 8;
+
+  if (DRAW_ROTATION != 0) {
+    // the fast path only knows the panel's own orientation
+    for (uint8_t j=0; j<h; j++) {
+      for (uint8_t i=0; i<w; i++) {
+        boolean set = pgm_read_byte(&bitmap[(j/8)*w + i]) & (1 << (j&7));
+        switch (op)
+        {
+        case SSD1306_COPY: drawPixel(x+i, y+j, set ? WHITE : BLACK); break;
+        case SSD1306_OR:   if (set) drawPixel(x+i, y+j, WHITE); break;
+        case SSD1306_AND:  if (!set) drawPixel(x+i, y+j, BLACK); break;
+        case SSD1306_XOR:  if (set) drawPixel(x+i, y+j, INVERSE); break;
+        }
+      }
+    }
+    return;
+  }
+
+  // clip to the columns on the panel
+  int16_t i0 = 0, i1 = w;
+  if (x < 0) {
+    i0 = -x;
+  }
+  if ((x + i1) > WIDTH) {
+    i1 = WIDTH - x;
+  }
+  if ((i0 >= i1) || (y >= HEIGHT) || ((y + h) <= 0)) {
+    return;
+  }
+
+  int8_t page0 = y >> 3; // rounds down for rows above the panel too
+  uint8_t shift = y & 7;
+
+  int8_t last = (y + h - 1) >> 3;
+  markDirty(x+i0, x+i1-1, (page0 < 0) ? 0 : page0,
+            (last >= SSD1306_LCDHEIGHT/8) ? SSD1306_LCDHEIGHT/8-1 : last);
+
+  for (uint8_t p=0; p<pages; p++) {
+    const uint8_t *src = &bitmap[p*w + i0];
+    int8_t dst = page0 + p;
+
+    // rows of the rectangle in this page of the bitmap, as they land
+    uint16_t mask = ((p == pages-1) ? (0xFF >> (8*pages - h)) : 0xFF) << shift;
+
+    uint8_t *pLo = pageInBuffer(dst) ? &buffer[BUFFER_PAGE(dst)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    uint8_t *pHi = ((mask >> 8) && pageInBuffer(dst+1)) ? &buffer[BUFFER_PAGE(dst+1)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    if (!pLo && !pHi) {
+      continue;
+    }
+
+    if ((mask == 0xFF) && (op == SSD1306_COPY)) {
+      // a whole page in place
+      memcpy_P(pLo, src, i1 - i0);
+      continue;
     }
 
+    for (int16_t i=i0; i<i1; i++) {
+      uint16_t bits = pgm_read_byte(src++) << shift;
+      if (pLo) {
+        ropByte(pLo++, bits, mask, op);
+      }
+      if (pHi) {
+        ropByte(pHi++, bits >> 8, mask >> 8, op);
+      }
+    }
+  }
 }
 
-Adafruit_SSD1306::Adafruit_SSD1306(int8_t SID, int8_t SCLK, int8_t DC, int8_t RST, int8_t CS) : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
+Adafruit_SSD1306::Adafruit_SSD1306(int8_t SID, int8_t SCLK, int8_t DC, int8_t RST, int8_t CS) : Adafruit_GFX_Fast<Adafruit_SSD1306>(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
   cs = CS;
   rst = RST;
   dc = DC;
   sclk = SCLK;
   sid = SID;
   hwSPI = false;
+  markAllDirty();
+  skippedChunks = 0;
+  background = NULL;
+#ifdef SSD1306_SHADOW_FRAME
+  shadowValid = false;
+  shadowAge = 0;
+#endif
+#ifdef SSD1306_ROTATION
+  Adafruit_GFX::setRotation(SSD1306_ROTATION);
+#endif
 }
 
 // constructor for hardware SPI - we indicate DataCommand, ChipSelect, Reset
-Adafruit_SSD1306::Adafruit_SSD1306(int8_t DC, int8_t RST, int8_t CS) : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
+Adafruit_SSD1306::Adafruit_SSD1306(int8_t DC, int8_t RST, int8_t CS) : Adafruit_GFX_Fast<Adafruit_SSD1306>(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
   dc = DC;
   rst = RST;
   cs = CS;
   hwSPI = true;
+  markAllDirty();
+  skippedChunks = 0;
+  background = NULL;
+#ifdef SSD1306_SHADOW_FRAME
+  shadowValid = false;
+  shadowAge = 0;
+#endif
+#ifdef SSD1306_ROTATION
+  Adafruit_GFX::setRotation(SSD1306_ROTATION);
+#endif
 }
 
 // initializer for I2C - we only indicate the reset pin!
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t reset) :
-Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
+Adafruit_GFX_Fast<Adafruit_SSD1306>(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT) {
   sclk = dc = cs = sid = -1;
   rst = reset;
+  markAllDirty();
+  skippedChunks = 0;
+  background = NULL;
+#ifdef SSD1306_SHADOW_FRAME
+  shadowValid = false;
+  shadowAge = 0;
+#endif
+#ifdef SSD1306_ROTATION
+  Adafruit_GFX::setRotation(SSD1306_ROTATION);
+#endif
 }
 
 
@@ -201,7 +752,16 @@ void Adafruit_SSD1306::begin(uint8_t vccstate, uint8_t i2caddr, bool reset) {
   else
   {
     // I2C Init
+#ifdef SSD1306_TWI_DIRECT
+    // internal pull-ups and 400KHz, the TWI is ours from here on
+    digitalWrite(SDA, HIGH);
+    digitalWrite(SCL, HIGH);
+    TWSR = 0;
+    TWBR = ((F_CPU / 400000L) - 16) / 2;
+    TWCR = _BV(TWEN);
+#else
     Wire.begin();
+#endif
 #ifdef __SAM3X8E__
     // Force 400 KHz I2C, rawr! (Uses pins 20, 21 for SDA, SCL)
     TWI1->TWI_CWGR = 0;
@@ -224,65 +784,17 @@ void Adafruit_SSD1306::begin(uint8_t vccstate, uint8_t i2caddr, bool reset) {
   }
 
   // Init sequence
-  ssd1306_command(SSD1306_DISPLAYOFF);                    // 0xAE
-  ssd1306_command(SSD1306_SETDISPLAYCLOCKDIV);            // 0xD5
-  ssd1306_command(0x80);                                  // the suggested ratio 0x80
-
-  ssd1306_command(SSD1306_SETMULTIPLEX);                  // 0xA8
-  ssd1306_command(SSD1306_LCDHEIGHT - 1);
-
-  ssd1306_command(SSD1306_SETDISPLAYOFFSET);              // 0xD3
-  ssd1306_command(0x0);                                   // no offset
-  ssd1306_command(SSD1306_SETSTARTLINE | 0x0);            // line #0
-  ssd1306_command(SSD1306_CHARGEPUMP);                    // 0x8D
-  if (vccstate == SSD1306_EXTERNALVCC)
-    { ssd1306_command(0x10); }
-  else
-    { ssd1306_command(0x14); }
-  ssd1306_command(SSD1306_MEMORYMODE);                    // 0x20
-  ssd1306_command(0x00);                                  // 0x0 act like ks0108
-  ssd1306_command(SSD1306_SEGREMAP | 0x1);
-  ssd1306_command(SSD1306_COMSCANDEC);
-
- #if defined SSD1306_128_32
-  ssd1306_command(SSD1306_SETCOMPINS);                    // 0xDA
-  ssd1306_command(0x02);
-  ssd1306_command(SSD1306_SETCONTRAST);                   // 0x81
-  ssd1306_command(0x8F);
-
-#elif defined SSD1306_128_64
-  ssd1306_command(SSD1306_SETCOMPINS);                    // 0xDA
-  ssd1306_command(0x12);
-  ssd1306_command(SSD1306_SETCONTRAST);                   // 0x81
-  if (vccstate == SSD1306_EXTERNALVCC)
-    { ssd1306_command(0x9F); }
-  else
-    { ssd1306_command(0xCF); }
-
-#elif defined SSD1306_96_16
-  ssd1306_command(SSD1306_SETCOMPINS);                    // 0xDA
-  ssd1306_command(0x2);   //ada x12
-  ssd1306_command(SSD1306_SETCONTRAST);                   // 0x81
   if (vccstate == SSD1306_EXTERNALVCC)
-    { ssd1306_command(0x10); }
+    { ssd1306_commandList_P(init_externalvcc, sizeof(init_externalvcc)); }
   else
-    { ssd1306_command(0xAF); }
+    { ssd1306_commandList_P(init_switchcapvcc, sizeof(init_switchcapvcc)); }
 
+  // display RAM content is undefined after reset, so the next display() must send everything
+  markAllDirty();
+#ifdef SSD1306_SHADOW_FRAME
+  shadowValid = false;
+  shadowAge = 0;
 #endif
-
-  ssd1306_command(SSD1306_SETPRECHARGE);                  // 0xd9
-  if (vccstate == SSD1306_EXTERNALVCC)
-    { ssd1306_command(0x22); }
-  else
-    { ssd1306_command(0xF1); }
-  ssd1306_command(SSD1306_SETVCOMDETECT);                 // 0xDB
-  ssd1306_command(0x40);
-  ssd1306_command(SSD1306_DISPLAYALLON_RESUME);           // 0xA4
-  ssd1306_command(SSD1306_NORMALDISPLAY);                 // 0xA6
-
-  ssd1306_command(SSD1306_DEACTIVATE_SCROLL);
-
-  ssd1306_command(SSD1306_DISPLAYON);//--turn on oled panel
 }
 
 
@@ -318,10 +830,77 @@ void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
   {
     // I2C
     uint8_t control = 0x00;   // Co = 0, D/C = 0
+#ifdef SSD1306_TWI_DIRECT
+    waitFlush();
+    if (twiStart(_i2caddr) && twiWrite(control) && twiWrite(c)) {
+      twiStop();
+    }
+#else
     Wire.beginTransmission(_i2caddr);
     Wire.write(control);
     Wire.write(c);
     Wire.endTransmission();
+#endif
+  }
+}
+
+void Adafruit_SSD1306::ssd1306_commandList(const uint8_t *c, uint8_t n) {
+  commandList(c, n, false);
+}
+
+void Adafruit_SSD1306::ssd1306_commandList_P(const uint8_t *c, uint8_t n) {
+  commandList(c, n, true);
+}
+
+void Adafruit_SSD1306::commandList(const uint8_t *c, uint8_t n, boolean progmem) {
+  if (sid != -1)
+  {
+    // SPI, the whole list under one chip select
+#ifdef HAVE_PORTREG
+    *csport |= cspinmask;
+    *dcport &= ~dcpinmask;
+    *csport &= ~cspinmask;
+#else
+    digitalWrite(cs, HIGH);
+    digitalWrite(dc, LOW);
+    digitalWrite(cs, LOW);
+#endif
+    while (n--) {
+      fastSPIwrite(progmem ? pgm_read_byte(c++) : *c++);
+    }
+#ifdef HAVE_PORTREG
+    *csport |= cspinmask;
+#else
+    digitalWrite(cs, HIGH);
+#endif
+  }
+  else
+  {
+#ifdef SSD1306_TWI_DIRECT
+    // I2C, the whole list behind one control byte
+    waitFlush();
+    if (!twiStart(_i2caddr) || !twiWrite(0x00)) {   // Co = 0, D/C = 0
+      return;
+    }
+    while (n--) {
+      if (!twiWrite(progmem ? pgm_read_byte(c++) : *c++)) {
+        return;
+      }
+    }
+    twiStop();
+#else
+    // I2C, one control byte then as many commands as the Wire buffer holds
+    while (n) {
+      uint8_t bytes = (n > SSD1306_WIRE_MAX) ? SSD1306_WIRE_MAX : n;
+      n -= bytes;
+      Wire.beginTransmission(_i2caddr);
+      WIRE_WRITE((uint8_t)0x00);   // Co = 0, D/C = 0
+      while (bytes--) {
+        WIRE_WRITE(progmem ? pgm_read_byte(c++) : *c++);
+      }
+      Wire.endTransmission();
+    }
+#endif
   }
 }
 
@@ -330,14 +909,11 @@ void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
 // Hint, the display is 16 rows tall. To scroll the whole display, run:
 // display.scrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop){
-  ssd1306_command(SSD1306_RIGHT_HORIZONTAL_SCROLL);
-  ssd1306_command(0X00);
-  ssd1306_command(start);
-  ssd1306_command(0X00);
-  ssd1306_command(stop);
-  ssd1306_command(0X00);
-  ssd1306_command(0XFF);
-  ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  uint8_t cmds[] = {
+    SSD1306_RIGHT_HORIZONTAL_SCROLL, 0X00, start, 0X00, stop, 0X00, 0XFF,
+    SSD1306_ACTIVATE_SCROLL
+  };
+  ssd1306_commandList(cmds, sizeof(cmds));
 }
 
 // startscrollleft
@@ -345,14 +921,11 @@ void Adafruit_SSD1306::startscrollright(uint8_t start, uint8_t stop){
 // Hint, the display is 16 rows tall. To scroll the whole display, run:
 // display.scrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop){
-  ssd1306_command(SSD1306_LEFT_HORIZONTAL_SCROLL);
-  ssd1306_command(0X00);
-  ssd1306_command(start);
-  ssd1306_command(0X00);
-  ssd1306_command(stop);
-  ssd1306_command(0X00);
-  ssd1306_command(0XFF);
-  ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  uint8_t cmds[] = {
+    SSD1306_LEFT_HORIZONTAL_SCROLL, 0X00, start, 0X00, stop, 0X00, 0XFF,
+    SSD1306_ACTIVATE_SCROLL
+  };
+  ssd1306_commandList(cmds, sizeof(cmds));
 }
 
 // startscrolldiagright
@@ -360,16 +933,12 @@ void Adafruit_SSD1306::startscrollleft(uint8_t start, uint8_t stop){
 // Hint, the display is 16 rows tall. To scroll the whole display, run:
 // display.scrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop){
-  ssd1306_command(SSD1306_SET_VERTICAL_SCROLL_AREA);
-  ssd1306_command(0X00);
-  ssd1306_command(SSD1306_LCDHEIGHT);
-  ssd1306_command(SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL);
-  ssd1306_command(0X00);
-  ssd1306_command(start);
-  ssd1306_command(0X00);
-  ssd1306_command(stop);
-  ssd1306_command(0X01);
-  ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  uint8_t cmds[] = {
+    SSD1306_SET_VERTICAL_SCROLL_AREA, 0X00, SSD1306_LCDHEIGHT,
+    SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL, 0X00, start, 0X00, stop, 0X01,
+    SSD1306_ACTIVATE_SCROLL
+  };
+  ssd1306_commandList(cmds, sizeof(cmds));
 }
 
 // startscrolldiagleft
@@ -377,16 +946,12 @@ void Adafruit_SSD1306::startscrolldiagright(uint8_t start, uint8_t stop){
 // Hint, the display is 16 rows tall. To scroll the whole display, run:
 // display.scrollright(0x00, 0x0F)
 void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop){
-  ssd1306_command(SSD1306_SET_VERTICAL_SCROLL_AREA);
-  ssd1306_command(0X00);
-  ssd1306_command(SSD1306_LCDHEIGHT);
-  ssd1306_command(SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL);
-  ssd1306_command(0X00);
-  ssd1306_command(start);
-  ssd1306_command(0X00);
-  ssd1306_command(stop);
-  ssd1306_command(0X01);
-  ssd1306_command(SSD1306_ACTIVATE_SCROLL);
+  uint8_t cmds[] = {
+    SSD1306_SET_VERTICAL_SCROLL_AREA, 0X00, SSD1306_LCDHEIGHT,
+    SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL, 0X00, start, 0X00, stop, 0X01,
+    SSD1306_ACTIVATE_SCROLL
+  };
+  ssd1306_commandList(cmds, sizeof(cmds));
 }
 
 void Adafruit_SSD1306::stopscroll(void){
@@ -403,88 +968,408 @@ void Adafruit_SSD1306::dim(boolean dim) {
     contrast = 0; // Dimmed display
   } else {
     if (_vccstate == SSD1306_EXTERNALVCC) {
-      contrast = 0x9F;
+      contrast = SSD1306_CONTRAST_EXTERNALVCC;
     } else {
-      contrast = 0xCF;
+      contrast = SSD1306_CONTRAST_SWITCHCAPVCC;
     }
   }
   // the range of contrast to too small to be really useful
   // it is useful to dim the display
-  ssd1306_command(SSD1306_SETCONTRAST);
-  ssd1306_command(contrast);
+  uint8_t cmds[] = { SSD1306_SETCONTRAST, contrast };
+  ssd1306_commandList(cmds, sizeof(cmds));
+}
+
+uint8_t Adafruit_SSD1306::getSkippedChunks(void) const {
+  return skippedChunks;
 }
 
 void Adafruit_SSD1306::display(void) {
-  ssd1306_command(SSD1306_COLUMNADDR);
-  ssd1306_command(0);   // Column start address (0 = reset)
-  ssd1306_command(SSD1306_LCDWIDTH-1); // Column end address (127 = reset)
-
-  ssd1306_command(SSD1306_PAGEADDR);
-  ssd1306_command(0); // Page start address (0 = reset)
-  #if SSD1306_LCDHEIGHT == 64
-    ssd1306_command(7); // Page end address
-  #endif
-  #if SSD1306_LCDHEIGHT == 32
-    ssd1306_command(3); // Page end address
-  #endif
-  #if SSD1306_LCDHEIGHT == 16
-    ssd1306_command(1); // Page end address
-  #endif
+#ifdef SSD1306_TWI_ASYNC
+  if (sid == -1) {
+    displayAsync();
+    waitFlush();
+    return;
+  }
+#endif
 
-  if (sid != -1)
-  {
-    // SPI
-#ifdef HAVE_PORTREG
-    *csport |= cspinmask;
-    *dcport |= dcpinmask;
-    *csport &= ~cspinmask;
-#else
-    digitalWrite(cs, HIGH);
-    digitalWrite(dc, HIGH);
-    digitalWrite(cs, LOW);
+#ifdef SSD1306_TWI_DIRECT
+  recoverTwi();
 #endif
 
-    for (uint16_t i=0; i<(SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8); i++) {
-      fastSPIwrite(buffer[i]);
-    }
-#ifdef HAVE_PORTREG
-    *csport |= cspinmask;
-#else
-    digitalWrite(cs, HIGH);
+#ifdef SSD1306_PAGE_BUFFER
+  // all there is to send is the page in the buffer
+  dirtyX0 = 0;
+  dirtyX1 = SSD1306_LCDWIDTH-1;
+  dirtyPage0 = dirtyPage1 = band;
 #endif
+
+  if (!prepareFlush()) {
+    return;
   }
-  else
-  {
-    // save I2C bitrate
-#ifdef TWBR
-    uint8_t twbrbackup = TWBR;
+
+  // save I2C bitrate (the direct TWI path set it once in begin())
+#if defined TWBR && !defined SSD1306_TWI_DIRECT
+  uint8_t twbrbackup = TWBR;
+  if (sid == -1) {
     TWBR = 12; // upgrade to 400KHz!
+  }
 #endif
 
-    //Serial.println(TWBR, DEC);
-    //Serial.println(TWSR & 0x3, DEC);
-
-    // I2C
-    for (uint16_t i=0; i<(SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8); i++) {
-      // send a bunch of data in one xmission
-      Wire.beginTransmission(_i2caddr);
-      WIRE_WRITE(0x40);
-      for (uint8_t x=0; x<16; x++) {
-        WIRE_WRITE(buffer[i]);
-        i++;
-      }
-      i--;
-      Wire.endTransmission();
+  while (nextWindow()) {
+    sendWindow(winX0, winX1, winPage0, winPage1);
+#ifdef SSD1306_TWI_DIRECT
+    if (twiFailed) {
+      break; // give up on this flush, the next one sends everything
     }
-#ifdef TWBR
-    TWBR = twbrbackup;
 #endif
   }
-}
 
-// clear everything
-void Adafruit_SSD1306::clearDisplay(void) {
-  memset(buffer, 0, (SSD1306_LCDWIDTH*SSD1306_LCDHEIGHT/8));
+#if defined TWBR && !defined SSD1306_TWI_DIRECT
+  TWBR = twbrbackup;
+#endif
+}
+
+#ifdef SSD1306_TWI_ASYNC
+
+void Adafruit_SSD1306::displayAsync(void) {
+  if (sid != -1) {
+    display();
+    return;
+  }
+
+  waitFlush();
+  recoverTwi();
+
+  if (!prepareFlush() || !nextWindow()) {
+    return;
+  }
+
+  twiAddr = _i2caddr;
+  twiLoadWindow();
+#ifdef SSD1306_TOUCHED_WINDOW
+  flushOpen = true;
+#endif
+  twiBusy = true;
+  TWCR = _BV(TWINT) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE);
+}
+
+boolean Adafruit_SSD1306::isFlushing(void) {
+  return twiBusy;
+}
+
+void Adafruit_SSD1306::waitFlush(void) {
+  while (twiBusy) {
+    // the interrupt does all the work
+  }
+  while (TWCR & _BV(TWSTO)) {
+    // let the final STOP go out
+  }
+#ifdef SSD1306_TOUCHED_WINDOW
+  flushOpen = false;
+#endif
+}
+
+#else
+
+void Adafruit_SSD1306::displayAsync(void) {
+  display();
+}
+
+boolean Adafruit_SSD1306::isFlushing(void) {
+  return false;
+}
+
+void Adafruit_SSD1306::waitFlush(void) {
+}
+
+#endif
+
+// snapshot the dirty window (and, with SSD1306_SHADOW_FRAME, which of its chunks changed) for
+// nextWindow() and reset it; returns false if there is nothing to send
+boolean Adafruit_SSD1306::prepareFlush(void) {
+  skippedChunks = 0;
+
+#if defined SSD1306_SHADOW_FRAME && !defined SSD1306_PAGE_BUFFER
+  // a chunk that changed to contents with the same CRC was skipped and is
+  // wrong on the panel, so every so often send everything regardless
+  if (++shadowAge == SSD1306_SHADOW_REFRESH) {
+    shadowAge = 0;
+    shadowValid = false;
+    markAllDirty();
+  }
+#endif
+
+  // nothing drawn since the last update, the panel is already current
+  if (dirtyX0 > dirtyX1) {
+    return false;
+  }
+
+  flushX0 = dirtyX0;
+  flushX1 = dirtyX1;
+  flushPage = dirtyPage0;
+  flushPage1 = dirtyPage1;
+
+#ifdef SSD1306_SHADOW_FRAME
+  uint8_t chunk0 = dirtyX0 / SSD1306_CHUNK_SIZE;
+  uint8_t chunk1 = dirtyX1 / SSD1306_CHUNK_SIZE;
+
+  flushChunk = chunk0;
+  memset(changed, 0, sizeof(changed));
+
+  for (uint8_t page=dirtyPage0; page<=dirtyPage1; page++) {
+    uint8_t index = page*SSD1306_CHUNKS_PER_PAGE + chunk0;
+    uint8_t *pBuf = &buffer[BUFFER_PAGE(page)*SSD1306_LCDWIDTH + chunk0*SSD1306_CHUNK_SIZE];
+#ifdef SSD1306_TOUCHED_WINDOW
+    uint8_t touched0 = 0xFF, touched1 = 0;
+    if ((page >= touchedPage0) && (page <= touchedPage1)) {
+      touched0 = touchedX0 / SSD1306_CHUNK_SIZE;
+      touched1 = touchedX1 / SSD1306_CHUNK_SIZE;
+    }
+#endif
+
+    for (uint8_t chunk=chunk0; chunk<=chunk1; chunk++, index++) {
+      uint16_t crc = 0xFFFF;
+      for (uint8_t i=0; i<SSD1306_CHUNK_SIZE; i++) {
+        crc = ssd1306_crc_update(crc, *pBuf++);
+      }
+
+#ifdef SSD1306_TOUCHED_WINDOW
+      if ((chunk >= touched0) && (chunk <= touched1)) {
+        shadow[index] = ~crc; // cannot match, so the chunk is sent
+      }
+#endif
+      if (!shadowValid || (crc != shadow[index])) {
+        shadow[index] = crc;
+        changed[index/8] |= (1 << (index&7));
+      } else {
+        skippedChunks++;
+      }
+    }
+  }
+
+  // CRCs outside the dirty window are only meaningful once the whole panel has been through here
+  if ((dirtyX0 == 0) && (dirtyX1 == SSD1306_LCDWIDTH-1) &&
+      (dirtyPage0 == 0) && (dirtyPage1 == (SSD1306_LCDHEIGHT/8)-1)) {
+    shadowValid = true;
+  }
+#ifdef SSD1306_TOUCHED_WINDOW
+  touchedX0 = touchedPage0 = 0xFF;
+  touchedX1 = touchedPage1 = 0;
+#endif
+#endif
+
+  // panel will match the buffer once the windows are sent
+  dirtyX0 = dirtyPage0 = 0xFF;
+  dirtyX1 = dirtyPage1 = 0;
+
+#ifdef SSD1306_DOUBLE_BUFFER
+  // send what was drawn and draw on over the frame before last, which
+  // can differ from the panel anywhere
+  uint8_t *t = frontBuffer;
+  frontBuffer = buffer;
+  buffer = t;
+  markAllDirty();
+#endif
+  return true;
+}
+
+// address columns x0..x1 of pages page0..page1 and send that part of the buffer
+void Adafruit_SSD1306::sendWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  uint8_t cmds[] = {
+    SSD1306_COLUMNADDR, x0, x1,    // Column start/end address
+    SSD1306_PAGEADDR, page0, page1 // Page start/end address
+  };
+  uint8_t cols = x1 - x0 + 1;
+
+  if (sid != -1)
+  {
+    // SPI
+    ssd1306_commandList(cmds, sizeof(cmds));
+#ifdef HAVE_PORTREG
+    *csport |= cspinmask;
+    *dcport |= dcpinmask;
+    *csport &= ~cspinmask;
+#else
+    digitalWrite(cs, HIGH);
+    digitalWrite(dc, HIGH);
+    digitalWrite(cs, LOW);
+#endif
+
+    for (uint8_t page=page0; page<=page1; page++) {
+      uint8_t *pBuf = &frontBuffer[BUFFER_PAGE(page)*SSD1306_LCDWIDTH + x0];
+      for (uint8_t x=0; x<cols; x++) {
+        fastSPIwrite(*pBuf++);
+      }
+    }
+#ifdef HAVE_PORTREG
+    *csport |= cspinmask;
+#else
+    digitalWrite(cs, HIGH);
+#endif
+  }
+#ifdef SSD1306_TWI_DIRECT
+  else
+  {
+    // I2C, one transaction: each command behind a Co=1 control byte, then
+    // a 0x40 control byte and the data straight from the buffer; a byte
+    // not acknowledged ends it there, and display() sends everything next
+    if (!twiStart(_i2caddr)) {
+      return;
+    }
+    for (uint8_t i=0; i<sizeof(cmds); i++) {
+      if (!twiWrite(0x80) || !twiWrite(cmds[i])) {   // Co = 1, D/C = 0
+        return;
+      }
+    }
+    if (!twiWrite(0x40)) {   // Co = 0, D/C = 1
+      return;
+    }
+    for (uint8_t page=page0; page<=page1; page++) {
+      uint8_t *pBuf = &frontBuffer[BUFFER_PAGE(page)*SSD1306_LCDWIDTH + x0];
+      for (uint8_t x=0; x<cols; x++) {
+        if (!twiWrite(*pBuf++)) {
+          return;
+        }
+      }
+    }
+    twiStop();
+  }
+#else
+  else
+  {
+    //Serial.println(TWBR, DEC);
+    //Serial.println(TWSR & 0x3, DEC);
+
+    // I2C
+    ssd1306_commandList(cmds, sizeof(cmds));
+    uint8_t sent = 0;
+    for (uint8_t page=page0; page<=page1; page++) {
+      uint8_t *pBuf = &frontBuffer[BUFFER_PAGE(page)*SSD1306_LCDWIDTH + x0];
+      for (uint8_t x=0; x<cols; x++) {
+        // send a bunch of data in one xmission, the window wraps to the next page by itself
+        if (sent == 0) {
+          Wire.beginTransmission(_i2caddr);
+          WIRE_WRITE(0x40);
+        }
+        WIRE_WRITE(*pBuf++);
+        if (++sent == SSD1306_CHUNK_SIZE) {
+          Wire.endTransmission();
+          sent = 0;
+        }
+      }
+    }
+    if (sent) {
+      Wire.endTransmission();
+    }
+  }
+#endif
+}
+
+// clear everything, back to the background if there is one
+void Adafruit_SSD1306::clearDisplay(void) {
+  if (background) {
+#ifdef SSD1306_PAGE_BUFFER
+    memcpy_P(buffer, &background[band*SSD1306_LCDWIDTH], SSD1306_BUFFER_SIZE);
+#else
+    memcpy_P(buffer, background, SSD1306_BUFFER_SIZE);
+#endif
+  } else {
+    memset(buffer, 0, SSD1306_BUFFER_SIZE);
+  }
+  markAllDirty();
+}
+
+void Adafruit_SSD1306::setBackground(const uint8_t *layer) {
+  background = layer;
+}
+
+#ifdef SSD1306_PAGE_BUFFER
+
+void Adafruit_SSD1306::firstPage(void) {
+  band = 0;
+  clearDisplay();
+
+#ifdef SSD1306_SHADOW_FRAME
+  // as in prepareFlush(), but for the whole picture loop
+  if (++shadowAge == SSD1306_SHADOW_REFRESH) {
+    shadowAge = 0;
+    shadowValid = false;
+  }
+#endif
+}
+
+boolean Adafruit_SSD1306::nextPage(void) {
+  display();
+
+#ifdef SSD1306_SHADOW_FRAME
+  // every page has been through prepareFlush() once the last one has
+  if (band == (SSD1306_LCDHEIGHT/8)-1) {
+    shadowValid = true;
+  }
+#endif
+
+  if (++band == SSD1306_LCDHEIGHT/8) {
+    band = 0;
+    return false;
+  }
+  clearDisplay();
+  return true;
+}
+
+#else
+
+void Adafruit_SSD1306::firstPage(void) {
+  clearDisplay();
+}
+
+boolean Adafruit_SSD1306::nextPage(void) {
+  display();
+  return false;
+}
+
+#endif
+
+// grow the dirty window to include columns x0..x1 of pages page0..page1
+inline void Adafruit_SSD1306::markDirty(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+  if (x0 < dirtyX0) dirtyX0 = x0;
+  if (x1 > dirtyX1) dirtyX1 = x1;
+  if (page0 < dirtyPage0) dirtyPage0 = page0;
+  if (page1 > dirtyPage1) dirtyPage1 = page1;
+#ifdef SSD1306_TOUCHED_WINDOW
+  if (flushOpen) {
+    if (x0 < touchedX0) touchedX0 = x0;
+    if (x1 > touchedX1) touchedX1 = x1;
+    if (page0 < touchedPage0) touchedPage0 = page0;
+    if (page1 > touchedPage1) touchedPage1 = page1;
+  }
+#endif
+}
+
+#ifdef SSD1306_TWI_DIRECT
+// after an abandoned transfer the panel may hold anything, so send all
+// of it, whatever the shadow frame says was sent
+void Adafruit_SSD1306::recoverTwi(void) {
+  if (twiFailed) {
+    twiFailed = false;
+    markAllDirty();
+#ifdef SSD1306_SHADOW_FRAME
+    shadowValid = false;
+#endif
+  }
+}
+#endif
+
+void Adafruit_SSD1306::markAllDirty(void) {
+  dirtyX0 = dirtyPage0 = 0;
+  dirtyX1 = SSD1306_LCDWIDTH-1;
+  dirtyPage1 = (SSD1306_LCDHEIGHT/8)-1;
+#ifdef SSD1306_TOUCHED_WINDOW
+  if (flushOpen) {
+    touchedX0 = touchedPage0 = 0;
+    touchedX1 = SSD1306_LCDWIDTH-1;
+    touchedPage1 = (SSD1306_LCDHEIGHT/8)-1;
+  }
+#endif
 }
 
 
@@ -511,7 +1396,7 @@ inline void Adafruit_SSD1306::fastSPIwrite(uint8_t d) {
 
 void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
   boolean bSwap = false;
-  switch(rotation) {
+  switch(DRAW_ROTATION) {
     case 0:
       // 0 degree rotation, do nothing
       break;
@@ -546,6 +1431,9 @@ void Adafruit_SSD1306::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t c
 void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) {
   // Do bounds/limit checks
   if(y < 0 || y >= HEIGHT) { return; }
+#ifdef SSD1306_PAGE_BUFFER
+  if((y/8) != band) { return; }
+#endif
 
   // make sure we don't try to draw below 0
   if(x < 0) {
@@ -561,10 +1449,12 @@ void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w, ui
   // if our width is now negative, punt
   if(w <= 0) { return; }
 
+  markDirty(x, x+w-1, y/8, y/8);
+
   // set up the pointer for  movement through the buffer
   register uint8_t *pBuf = buffer;
   // adjust the buffer pointer for the current row
-  pBuf += ((y/8) * SSD1306_LCDWIDTH);
+  pBuf += (BUFFER_PAGE(y/8) * SSD1306_LCDWIDTH);
   // and offset x columns in
   pBuf += x;
 
@@ -580,7 +1470,7 @@ void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w, ui
 
 void Adafruit_SSD1306::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
   bool bSwap = false;
-  switch(rotation) {
+  switch(DRAW_ROTATION) {
     case 0:
       break;
     case 1:
@@ -630,11 +1520,25 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h
     __h = (HEIGHT - __y);
   }
 
+#ifdef SSD1306_PAGE_BUFFER
+  // and keep to the rows of the page being drawn
+  int16_t top = band*8;
+  if(__y < top) {
+    __h -= top - __y;
+    __y = top;
+  }
+  if( (__y + __h) > (top + 8)) {
+    __h = (top + 8 - __y);
+  }
+#endif
+
   // if our height is now negative, punt
   if(__h <= 0) {
     return;
   }
 
+  markDirty(x, x, __y/8, (__y+__h-1)/8);
+
   // this display doesn't need ints for coordinates, use local byte registers for faster juggling
   register uint8_t y = __y;
   register uint8_t h = __h;
@@ -643,7 +1547,7 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h
   // set up the pointer for fast movement through the buffer
   register uint8_t *pBuf = buffer;
   // adjust the buffer pointer for the current row
-  pBuf += ((y/8) * SSD1306_LCDWIDTH);
+  pBuf += (BUFFER_PAGE(y/8) * SSD1306_LCDWIDTH);
   // and offset x columns in
   pBuf += x;
 
@@ -725,3 +1629,644 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y, int16_t __h
     }
   }
 }
+
+// map a rectangle from the rotated coordinates to the panel's own
+void Adafruit_SSD1306::rotateRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) {
+  switch(DRAW_ROTATION) {
+    case 1:
+      ssd1306_swap(x, y);
+      ssd1306_swap(w, h);
+      x = WIDTH - x - w;
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      ssd1306_swap(x, y);
+      ssd1306_swap(w, h);
+      y = HEIGHT - y - h;
+      break;
+  }
+}
+
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if((w <= 0) || (h <= 0)) { return; }
+
+  rotateRect(x, y, w, h);
+  fillRectInternal(x, y, w, h, color);
+}
+
+void Adafruit_SSD1306::fillScreen(uint16_t color) {
+  fillRectInternal(0, 0, WIDTH, HEIGHT, color);
+}
+
+// the outline as two rows and the columns between them, so no pixel is
+// touched twice (the generic version flips the corners back with INVERSE)
+void Adafruit_SSD1306::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if((w <= 0) || (h <= 0)) { return; }
+
+  rotateRect(x, y, w, h);
+  drawFastHLineInternal(x, y, w, color);
+  if(h > 1) {
+    drawFastHLineInternal(x, y+h-1, w, color);
+  }
+  if(h > 2) {
+    drawFastVLineInternal(x, y+1, h-2, color);
+    if(w > 1) {
+      drawFastVLineInternal(x+w-1, y+1, h-2, color);
+    }
+  }
+}
+
+// fill in panel coordinates: the masks for the top and bottom pages are
+// worked out once, the pages in between are whole bytes
+void Adafruit_SSD1306::fillRectInternal(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  // clip to the panel
+  if(x < 0) {
+    w += x;
+    x = 0;
+  }
+  if(y < 0) {
+    h += y;
+    y = 0;
+  }
+  if((x + w) > WIDTH) {
+    w = WIDTH - x;
+  }
+  if((y + h) > HEIGHT) {
+    h = HEIGHT - y;
+  }
+  if((w <= 0) || (h <= 0)) { return; }
+
+  uint8_t page0 = y/8, page1 = (y+h-1)/8;
+  uint8_t topMask = 0xFF << (y&7);
+  uint8_t bottomMask = 0xFF >> (7 - ((y+h-1)&7));
+
+  markDirty(x, x+w-1, page0, page1);
+
+  for (uint8_t p=page0; p<=page1; p++) {
+    if (!pageInBuffer(p)) {
+      continue;
+    }
+
+    uint8_t mask = 0xFF;
+    if (p == page0) {
+      mask &= topMask;
+    }
+    if (p == page1) {
+      mask &= bottomMask;
+    }
+
+    register uint8_t *pBuf = &buffer[BUFFER_PAGE(p)*SSD1306_LCDWIDTH + x];
+    register uint8_t n = w;
+
+    if ((mask == 0xFF) && ((color == WHITE) || (color == BLACK))) {
+      memset(pBuf, (color == WHITE) ? 0xFF : 0x00, n);
+      continue;
+    }
+
+    switch (color)
+    {
+    case WHITE:                 while(n--) { *pBuf++ |= mask; }; break;
+    case BLACK: mask = ~mask;   while(n--) { *pBuf++ &= mask; }; break;
+    case INVERSE:               while(n--) { *pBuf++ ^= mask; }; break;
+    }
+  }
+}
+
+// as fillRectInternal(), but each masked byte comes from the background
+void Adafruit_SSD1306::clearRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+  if((w <= 0) || (h <= 0)) { return; }
+
+  rotateRect(x, y, w, h);
+  if (!background) {
+    fillRectInternal(x, y, w, h, BLACK);
+    return;
+  }
+
+  // clip to the panel
+  if(x < 0) {
+    w += x;
+    x = 0;
+  }
+  if(y < 0) {
+    h += y;
+    y = 0;
+  }
+  if((x + w) > WIDTH) {
+    w = WIDTH - x;
+  }
+  if((y + h) > HEIGHT) {
+    h = HEIGHT - y;
+  }
+  if((w <= 0) || (h <= 0)) { return; }
+
+  uint8_t page0 = y/8, page1 = (y+h-1)/8;
+
+  markDirty(x, x+w-1, page0, page1);
+
+  for (uint8_t p=page0; p<=page1; p++) {
+    if (!pageInBuffer(p)) {
+      continue;
+    }
+
+    uint8_t mask = 0xFF;
+    if (p == page0) {
+      mask &= 0xFF << (y&7);
+    }
+    if (p == page1) {
+      mask &= 0xFF >> (7 - ((y+h-1)&7));
+    }
+
+    uint8_t *pBuf = &buffer[BUFFER_PAGE(p)*SSD1306_LCDWIDTH + x];
+    const uint8_t *pBg = &background[p*SSD1306_LCDWIDTH + x];
+    for (uint8_t n=w; n; n--, pBuf++) {
+      *pBuf = (*pBuf & ~mask) | (pgm_read_byte(pBg++) & mask);
+    }
+  }
+}
+
+// distance in the buffer from a page to the one below it
+#define PAGE_STRIDE (BUFFER_PAGE(1)*SSD1306_LCDWIDTH)
+
+// move a pointer and bit mask one row down or up, onto the next page when
+// the bit leaves the byte (page only matters with SSD1306_PAGE_BUFFER)
+static inline void rowDown(uint8_t *&pBuf, uint8_t &mask, int8_t &page) {
+  mask <<= 1;
+  if (!mask) {
+    mask = 0x01;
+    pBuf += PAGE_STRIDE;
+    page++;
+  }
+}
+
+static inline void rowUp(uint8_t *&pBuf, uint8_t &mask, int8_t &page) {
+  mask >>= 1;
+  if (!mask) {
+    mask = 0x80;
+    pBuf -= PAGE_STRIDE;
+    page--;
+  }
+}
+
+// set one pixel known to be on the panel, no rotation, clipping or dirty window
+static inline void plotPixel(uint8_t x, uint8_t y, uint16_t color) {
+#ifdef SSD1306_PAGE_BUFFER
+  if ((y/8) != band)
+    return;
+#endif
+  blitByte(&buffer[BUFFER_PAGE(y/8)*SSD1306_LCDWIDTH + x], 1 << (y&7), color);
+}
+
+// Bresenham's algorithm as in Adafruit_GFX, but walking the buffer: a step
+// along x moves the pointer a column, a step along y moves the mask a bit
+void Adafruit_SSD1306::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  int16_t left = x0, right = x1, top = y0, bottom = y1;
+  if (left > right) {
+    ssd1306_swap(left, right);
+  }
+  if (top > bottom) {
+    ssd1306_swap(top, bottom);
+  }
+
+  if ((DRAW_ROTATION != 0) || (left < 0) || (right >= WIDTH) || (top < 0) || (bottom >= HEIGHT)) {
+    Adafruit_GFX_Core<Adafruit_SSD1306>::drawLine(*this, x0, y0, x1, y1, color);
+    return;
+  }
+
+  markDirty(left, right, top/8, bottom/8);
+
+  boolean steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    ssd1306_swap(x0, y0);
+    ssd1306_swap(x1, y1);
+  }
+
+  if (x0 > x1) {
+    ssd1306_swap(x0, x1);
+    ssd1306_swap(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  boolean forward = (y0 < y1);
+
+  // the first pixel, back in panel coordinates
+  uint8_t px = steep ? y0 : x0;
+  uint8_t py = steep ? x0 : y0;
+  int8_t page = py/8;
+  uint8_t mask = 1 << (py&7);
+  uint8_t *pBuf = &buffer[BUFFER_PAGE(page)*SSD1306_LCDWIDTH + px];
+
+  for (int16_t n=dx; n>=0; n--) {
+#ifdef SSD1306_PAGE_BUFFER
+    if (page == band)
+#endif
+      blitByte(pBuf, mask, color);
+
+    err -= dy;
+    boolean minor = (err < 0);
+    if (minor) {
+      err += dx;
+    }
+
+    if (steep) {
+      // down a row, and a column across when the error runs out
+      rowDown(pBuf, mask, page);
+      if (minor) {
+        pBuf += forward ? 1 : -1;
+      }
+    } else {
+      // a column across, and a row down or up when the error runs out
+      pBuf++;
+      if (minor) {
+        if (forward) {
+          rowDown(pBuf, mask, page);
+        } else {
+          rowUp(pBuf, mask, page);
+        }
+      }
+    }
+  }
+}
+
+// midpoint circle as in Adafruit_GFX, the eight symmetric points stored
+// directly once the whole circle is known to be on the panel
+void Adafruit_SSD1306::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  if ((DRAW_ROTATION != 0) || (r < 0) ||
+      (x0 - r < 0) || (x0 + r >= WIDTH) || (y0 - r < 0) || (y0 + r >= HEIGHT)) {
+    Adafruit_GFX_Core<Adafruit_SSD1306>::drawCircle(*this, x0, y0, r, color);
+    return;
+  }
+
+  markDirty(x0 - r, x0 + r, (y0 - r)/8, (y0 + r)/8);
+
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  plotPixel(x0  , y0+r, color);
+  plotPixel(x0  , y0-r, color);
+  plotPixel(x0+r, y0  , color);
+  plotPixel(x0-r, y0  , color);
+
+  while (x<y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    plotPixel(x0 + x, y0 + y, color);
+    plotPixel(x0 - x, y0 + y, color);
+    plotPixel(x0 + x, y0 - y, color);
+    plotPixel(x0 - x, y0 - y, color);
+    plotPixel(x0 + y, y0 + x, color);
+    plotPixel(x0 - y, y0 + x, color);
+    plotPixel(x0 + y, y0 - x, color);
+    plotPixel(x0 - y, y0 - x, color);
+  }
+}
+
+// a row of fillTriangle(), clipped to the panel (and the band) and stored
+// a byte per column with the row's bit
+struct bufferSpan {
+  uint16_t color;
+
+  void operator()(int16_t a, int16_t b, int16_t y) {
+    if ((y < 0) || (y >= SSD1306_LCDHEIGHT)) {
+      return;
+    }
+#ifdef SSD1306_PAGE_BUFFER
+    if ((y/8) != band) {
+      return;
+    }
+#endif
+    if (a < 0) {
+      a = 0;
+    }
+    if (b >= SSD1306_LCDWIDTH) {
+      b = SSD1306_LCDWIDTH - 1;
+    }
+    if (a > b) {
+      return;
+    }
+
+    register uint8_t *pBuf = &buffer[BUFFER_PAGE(y/8)*SSD1306_LCDWIDTH + a];
+    register uint8_t mask = 1 << (y&7);
+    register uint8_t n = b - a + 1;
+
+    switch (color)
+    {
+    case WHITE:                 while(n--) { *pBuf++ |= mask; }; break;
+    case BLACK: mask = ~mask;   while(n--) { *pBuf++ &= mask; }; break;
+    case INVERSE:               while(n--) { *pBuf++ ^= mask; }; break;
+    }
+  }
+};
+
+void Adafruit_SSD1306::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+  if (DRAW_ROTATION != 0) {
+    Adafruit_GFX_Core<Adafruit_SSD1306>::fillTriangle(*this, x0, y0, x1, y1, x2, y2, color);
+    return;
+  }
+
+  // one dirty window for the whole triangle, clipped to the panel
+  int16_t left = x0, right = x0, top = y0, bottom = y0;
+  if (x1 < left) left = x1;
+  if (x2 < left) left = x2;
+  if (x1 > right) right = x1;
+  if (x2 > right) right = x2;
+  if (y1 < top) top = y1;
+  if (y2 < top) top = y2;
+  if (y1 > bottom) bottom = y1;
+  if (y2 > bottom) bottom = y2;
+  if ((right < 0) || (left >= WIDTH) || (bottom < 0) || (top >= HEIGHT)) {
+    return;
+  }
+  if (left < 0) left = 0;
+  if (right >= WIDTH) right = WIDTH - 1;
+  if (top < 0) top = 0;
+  if (bottom >= HEIGHT) bottom = HEIGHT - 1;
+  markDirty(left, right, top/8, bottom/8);
+
+  bufferSpan span = { color };
+  Adafruit_GFX_triangleSpans(x0, y0, x1, y1, x2, y2, span);
+}
+
+// combine a glyph column into the buffer: its set bits in color and, when
+// bg differs, the other rows of the cell (mask) in bg
+static inline void glyphByte(uint8_t *pBuf, uint8_t bits, uint8_t mask, uint16_t color, uint16_t bg) {
+  if ((color == WHITE) && (bg == BLACK) && (mask == 0xFF)) {
+    // opaque and page aligned, the column is the byte
+    *pBuf = bits;
+    return;
+  }
+  blitByte(pBuf, bits, color);
+  if (bg != color) {
+    blitByte(pBuf, mask & ~bits, bg);
+  }
+}
+
+// every bit of a nibble repeated 2, 3 or 4 times, to scale font columns
+static const uint16_t PROGMEM glyphScale[3][16] = {
+  {0x0000, 0x0003, 0x000C, 0x000F, 0x0030, 0x0033, 0x003C, 0x003F, 0x00C0, 0x00C3, 0x00CC, 0x00CF, 0x00F0, 0x00F3, 0x00FC, 0x00FF},
+  {0x0000, 0x0007, 0x0038, 0x003F, 0x01C0, 0x01C7, 0x01F8, 0x01FF, 0x0E00, 0x0E07, 0x0E38, 0x0E3F, 0x0FC0, 0x0FC7, 0x0FF8, 0x0FFF},
+  {0x0000, 0x000F, 0x00F0, 0x00FF, 0x0F00, 0x0F0F, 0x0FF0, 0x0FFF, 0xF000, 0xF00F, 0xF0F0, 0xF0FF, 0xFF00, 0xFF0F, 0xFFF0, 0xFFFF},
+};
+
+// a font column stretched to size rows per bit
+static inline uint32_t scaleColumn(uint8_t line, uint8_t size) {
+  if (size == 1) {
+    return line;
+  }
+  const uint16_t *t = glyphScale[size - 2];
+  return pgm_read_word(&t[line & 0x0F]) | ((uint32_t)pgm_read_word(&t[line >> 4]) << (4*size));
+}
+
+void Adafruit_SSD1306::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+  if (gfxFont && (size == 1) && (DRAW_ROTATION == 0) &&
+      (pgm_read_byte(&gfxFont->flags) & (GFXFONT_PAGES | GFXFONT_RLE))) {
+    drawPageGlyph(x, y, c, color);
+    return;
+  }
+  if (gfxFont || (size < 1) || (size > 4) || (DRAW_ROTATION != 0)) {
+    Adafruit_GFX_Core<Adafruit_SSD1306>::drawChar(*this, x, y, c, color, bg, size);
+    return;
+  }
+
+  // the 6x8 cell scaled up, its sixth column being the gap after the glyph
+  uint8_t cellHeight = 8 * size;
+  int16_t i0 = 0, i1 = 6 * size;
+  if (x < 0) {
+    i0 = -x;
+  }
+  if ((x + i1) > WIDTH) {
+    i1 = WIDTH - x;
+  }
+  if ((i0 >= i1) || (y >= HEIGHT) || ((y + cellHeight) <= 0)) {
+    return;
+  }
+
+  if (!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+
+  int8_t page0 = y >> 3; // rounds down for rows above the panel too
+  int8_t last = (y + cellHeight - 1) >> 3;
+  uint8_t shift = y & 7;
+
+  markDirty(x+i0, x+i1-1, (page0 < 0) ? 0 : page0,
+            (last >= SSD1306_LCDHEIGHT/8) ? SSD1306_LCDHEIGHT/8-1 : last);
+
+  // the scaled columns, then the rows of the cell (for the background),
+  // moved down by shift: bits is what lands in the current page and rest
+  // what is still to come, a byte per page
+  uint8_t bits[7];
+  uint32_t rest[7];
+  for (uint8_t i=0; i<7; i++) {
+    uint32_t v;
+    if (i < 5) {
+      v = scaleColumn(pgm_read_byte(&classicFont[c*5 + i]), size);
+    } else if (i == 5) {
+      v = 0;
+    } else {
+      v = 0xFFFFFFFF >> (32 - cellHeight);
+    }
+    bits[i] = v << shift;
+    rest[i] = v >> (8 - shift);
+  }
+
+  for (int8_t p=page0; p<=last; p++) {
+    if (pageInBuffer(p)) {
+      uint8_t *pBuf = &buffer[BUFFER_PAGE(p)*SSD1306_LCDWIDTH + x + i0];
+      uint8_t column = i0 / size, repeat = i0 % size;
+      for (int16_t i=i0; i<i1; i++) {
+        glyphByte(pBuf++, bits[column], bits[6], color, bg);
+        if (++repeat == size) {
+          repeat = 0;
+          column++;
+        }
+      }
+    }
+
+    for (uint8_t i=0; i<7; i++) {
+      bits[i] = rest[i];
+      rest[i] >>= 8;
+    }
+  }
+}
+
+// a glyph of a GFXFONT_PAGES or GFXFONT_RLE font, cursor at (x, y) on the
+// baseline: its bytes are columns already, shifted into the pages below
+// like a sprite's.  Every byte is read, clipped or not, as RLE runs can't
+// be skipped over
+void Adafruit_SSD1306::drawPageGlyph(int16_t x, int16_t y, unsigned char c, uint16_t color) {
+  GFXglyph *glyph = Adafruit_GFX_findGlyph(gfxFont, c);
+  if (!glyph) {
+    return;
+  }
+  uint8_t w = pgm_read_byte(&glyph->width),
+          h = pgm_read_byte(&glyph->height);
+  x += (int8_t)pgm_read_byte(&glyph->xOffset);
+  y += (int8_t)pgm_read_byte(&glyph->yOffset);
+
+  // clip to the columns on the panel
+  int16_t i0 = 0, i1 = w;
+  if (x < 0) {
+    i0 = -x;
+  }
+  if ((x + i1) > WIDTH) {
+    i1 = WIDTH - x;
+  }
+  if ((i0 >= i1) || (y >= HEIGHT) || ((y + h) <= 0)) {
+    return;
+  }
+
+  int8_t page0 = y >> 3; // rounds down for rows above the panel too
+  int8_t last = (y + h - 1) >> 3;
+  uint8_t shift = y & 7;
+
+  markDirty(x+i0, x+i1-1, (page0 < 0) ? 0 : page0,
+            (last >= SSD1306_LCDHEIGHT/8) ? SSD1306_LCDHEIGHT/8-1 : last);
+
+  Adafruit_GFX_GlyphReader r;
+  r.start(gfxFont, glyph, c);
+
+  uint8_t pages = (h + 7) / 8;
+  for (int16_t i=0; i<w; i++) {
+    for (uint8_t p=0; p<pages; p++) {
+      uint16_t bits = r.next() << shift;
+      if ((i < i0) || (i >= i1) || !bits) {
+        continue;
+      }
+
+      // top part of each byte lands in page dst, the rest in the page below
+      int8_t dst = page0 + p;
+      if (pageInBuffer(dst)) {
+        blitByte(&buffer[BUFFER_PAGE(dst)*SSD1306_LCDWIDTH + x + i], bits, color);
+      }
+      if (shift && pageInBuffer(dst+1)) {
+        blitByte(&buffer[BUFFER_PAGE(dst+1)*SSD1306_LCDWIDTH + x + i], bits >> 8, color);
+      }
+    }
+  }
+}
+
+#ifdef SSD1306_TEXT_CACHE
+#define TEXT_SLOT_SIZE (SSD1306_TEXT_CACHE / SSD1306_TEXT_CACHE_ENTRIES)
+
+// what each drawCachedText() slot holds, size 0 until first used; the
+// rendering is size pages of w bytes in the slot's share of the arena
+typedef struct {
+  char text[SSD1306_TEXT_CACHE_LENGTH + 1];
+  uint8_t size;
+  uint8_t w;
+  boolean cp437;
+} cachedText;
+
+static uint8_t textArena[SSD1306_TEXT_CACHE_ENTRIES][TEXT_SLOT_SIZE];
+static cachedText textCache[SSD1306_TEXT_CACHE_ENTRIES];
+#endif
+
+void Adafruit_SSD1306::drawCachedText(uint8_t slot, int16_t x, int16_t y, const char *text) {
+#ifdef SSD1306_TEXT_CACHE
+  uint8_t size = textsize;
+  size_t len = strlen(text);
+
+  if ((DRAW_ROTATION == 0) && (size >= 1) && (size <= 4) &&
+      (slot < SSD1306_TEXT_CACHE_ENTRIES) && (len <= SSD1306_TEXT_CACHE_LENGTH) &&
+      (6 * size * size * len <= TEXT_SLOT_SIZE) && (6 * size * len <= 255)) {
+    cachedText *t = &textCache[slot];
+    uint8_t *bitmap = textArena[slot];
+
+    if ((t->size != size) || (t->cp437 != _cp437) || strcmp(t->text, text)) {
+      // changed, render the glyph columns again, stretched as drawChar() does
+      t->w = 6 * size * len;
+      uint8_t *dst = bitmap;
+      for (uint8_t n=0; n<len; n++) {
+        unsigned char c = text[n];
+        if (!_cp437 && (c >= 176)) c++; // Handle 'classic' charset behavior
+
+        for (uint8_t i=0; i<6; i++) {
+          uint32_t v = (i < 5) ? scaleColumn(pgm_read_byte(&classicFont[c*5 + i]), size) : 0;
+          for (uint8_t r=0; r<size; r++) {
+            for (uint8_t p=0; p<size; p++) {
+              dst[p * t->w] = v >> (8*p);
+            }
+            dst++;
+          }
+        }
+      }
+      strcpy(t->text, text);
+      t->size = size;
+      t->cp437 = _cp437;
+    }
+
+    blitText(x, y, bitmap, t->w, size, textcolor, textbgcolor);
+    return;
+  }
+#else
+  (void)slot;
+#endif
+
+  // glyph by glyph, still in the classic font when a custom one is set
+  GFXfont *font = gfxFont;
+  gfxFont = NULL;
+  for (; *text; text++, x += 6 * textsize) {
+    drawChar(x, y, *text, textcolor, textbgcolor, textsize);
+  }
+  gfxFont = font;
+}
+
+// combine text rendered by drawCachedText(), pages of w bytes from RAM, as
+// drawChar() would have drawn it: shifted into the pages below y, with the
+// rest of the cell in bg when that differs from color
+void Adafruit_SSD1306::blitText(int16_t x, int16_t y, const uint8_t *src, uint8_t w, uint8_t pages, uint16_t color, uint16_t bg) {
+  // clip to the columns on the panel
+  int16_t i0 = 0, i1 = w;
+  if (x < 0) {
+    i0 = -x;
+  }
+  if ((x + i1) > WIDTH) {
+    i1 = WIDTH - x;
+  }
+  if ((i0 >= i1) || (y >= HEIGHT) || ((y + pages*8) <= 0)) {
+    return;
+  }
+
+  int8_t page0 = y >> 3; // rounds down for rows above the panel too
+  int8_t last = (y + pages*8 - 1) >> 3;
+  uint8_t shift = y & 7;
+  uint16_t mask = 0xFF << shift;
+
+  markDirty(x+i0, x+i1-1, (page0 < 0) ? 0 : page0,
+            (last >= SSD1306_LCDHEIGHT/8) ? SSD1306_LCDHEIGHT/8-1 : last);
+
+  for (uint8_t p=0; p<pages; p++) {
+    const uint8_t *row = &src[p*w + i0];
+    int8_t dst = page0 + p;
+
+    // top part of each byte lands in page dst, the rest in the page below
+    uint8_t *pLo = pageInBuffer(dst) ? &buffer[BUFFER_PAGE(dst)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    uint8_t *pHi = (shift && pageInBuffer(dst+1)) ? &buffer[BUFFER_PAGE(dst+1)*SSD1306_LCDWIDTH + x + i0] : NULL;
+    if (!pLo && !pHi) {
+      continue;
+    }
+
+    for (int16_t i=i0; i<i1; i++) {
+      uint16_t bits = *row++ << shift;
+      if (pLo) {
+        glyphByte(pLo++, bits, mask, color, bg);
+      }
+      if (pHi) {
+        glyphByte(pHi++, bits >> 8, mask >> 8, color, bg);
+      }
+    }
+  }
+}
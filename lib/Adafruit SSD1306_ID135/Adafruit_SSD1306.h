@@ -49,6 +49,12 @@ All text above, and the splash screen must be included in any redistribution
 #define WHITE 1
 #define INVERSE 2
 
+// raster ops for drawPageBitmap()
+#define SSD1306_COPY 0
+#define SSD1306_OR   1
+#define SSD1306_AND  2
+#define SSD1306_XOR  3
+
 #define SSD1306_I2C_ADDRESS   0x3C  // 011110+SA0+RW - 0x3C or 0x3D
 // Address for 128x32 is 0x3C
 // Address for 128x64 is 0x3D (default) or 0x3C (if SA0 is grounded)
@@ -72,6 +78,146 @@ All text above, and the splash screen must be included in any redistribution
 //   #define SSD1306_96_16
 /*=========================================================================*/
 
+/*=========================================================================
+    Shadow frame
+    -----------------------------------------------------------------------
+    When defined, display() remembers a CRC of every 16-byte chunk of the
+    buffer it has sent, and skips chunks that are unchanged since, so that
+    a sketch that clears and redraws the whole frame every time only pays
+    bus time for what actually moved.  Costs 2 bytes of RAM per chunk
+    (128 bytes on 128x64).
+
+    The CRC is not a copy: about 1 in 65536 changed chunks gets the same
+    CRC as before and is not sent (changes within 16 consecutive bits
+    always show).  Such a chunk stays wrong on the panel until it changes
+    again or, at the latest, until the next full resend, which display()
+    does every SSD1306_SHADOW_REFRESH calls (64 unless set).  Off unless
+    defined; sketches that only draw what moved gain little from it.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_SHADOW_FRAME
+/*=========================================================================*/
+
+/*=========================================================================
+    Direct TWI (AVR only)
+    -----------------------------------------------------------------------
+    When defined, the I2C path drives the TWI peripheral itself instead of
+    going through Wire.  Each window of display() then goes out as a single
+    transaction straight from the buffer, with no 32-byte Wire chunks and
+    no copies, and the bus is set to 400KHz once in begin().  Wire cannot
+    be used by anything else in the same sketch.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_TWI_DIRECT
+/*=========================================================================*/
+
+/*=========================================================================
+    Asynchronous I2C flush (AVR only)
+    -----------------------------------------------------------------------
+    When defined, displayAsync() streams the changed part of the buffer
+    from the TWI interrupt while the sketch carries on.  Implies
+    SSD1306_TWI_DIRECT, and the driver also owns the TWI vector.  Usually
+    set from the build flags.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_TWI_ASYNC
+/*=========================================================================*/
+
+/*=========================================================================
+    Double buffering
+    -----------------------------------------------------------------------
+    When defined, drawing goes to a back buffer and display() swaps it with
+    the front buffer that is being sent, so the next frame can be drawn
+    while the last one is still going out (see displayAsync()).  Costs a
+    second frame buffer of RAM, which rules out the Uno.  After display()
+    the back buffer holds the frame before last, so sketches should clear
+    or fully redraw it.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_DOUBLE_BUFFER
+/*=========================================================================*/
+
+/*=========================================================================
+    Page buffer
+    -----------------------------------------------------------------------
+    When defined, the buffer holds a single 8-row page (128 bytes instead
+    of 1KB on 128x64).  Frames are drawn with a picture loop,
+
+        display.firstPage();
+        do {
+          ...draw the whole frame...
+        } while (display.nextPage());
+
+    which runs the drawing once per page, keeps only what falls in that
+    page and sends it before moving on to the next.  display() sends just
+    the page in the buffer.  Cannot be combined with SSD1306_DOUBLE_BUFFER
+    or SSD1306_TWI_ASYNC.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_PAGE_BUFFER
+/*=========================================================================*/
+
+/*=========================================================================
+    Sprite cache
+    -----------------------------------------------------------------------
+    When set to a number of bytes, drawSprite() keeps copies of the sprites
+    it draws in a RAM arena of that size, pre-shifted for each of the 8 row
+    offsets within a page, so blitting them needs no shifting at all.  The
+    copies are made the first time a sprite is drawn and take 8 * w *
+    (pages + 1) bytes (216 for a 9x9 sprite).  Sprites that do not fit, or
+    come after SSD1306_SPRITE_CACHE_ENTRIES others, are shifted as usual.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_SPRITE_CACHE 344
+/*=========================================================================*/
+
+/*=========================================================================
+    Text cache
+    -----------------------------------------------------------------------
+    When set to a number of bytes, drawCachedText() keeps the text of each
+    of its SSD1306_TEXT_CACHE_ENTRIES slots rendered in page format, in an
+    equal share of a RAM arena of that size, and while it stays the same
+    only blits the copy.  A slot is rendered again when its text or the
+    text size changes.  A character takes 6 * size * size bytes (24 at
+    size 2); text that does not fit its share, or is longer than
+    SSD1306_TEXT_CACHE_LENGTH characters, is drawn glyph by glyph.  Either
+    way the text is in the classic font, even with a custom font set.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_TEXT_CACHE 96
+/*=========================================================================*/
+
+/*=========================================================================
+    Fixed rotation
+    -----------------------------------------------------------------------
+    When set to 0-3, the display starts in that rotation and keeps it:
+    drawPixel(), the fast lines and drawSprite() map coordinates with a
+    constant instead of switching on the rotation for every call, and
+    setRotation() is not available.  Leave it undefined to rotate at run
+    time.
+    -----------------------------------------------------------------------*/
+//   #define SSD1306_ROTATION 0
+/*=========================================================================*/
+
+#if defined SSD1306_SHADOW_FRAME && !defined SSD1306_SHADOW_REFRESH
+  #define SSD1306_SHADOW_REFRESH 64
+#endif
+
+#if defined SSD1306_SPRITE_CACHE && !defined SSD1306_SPRITE_CACHE_ENTRIES
+  #define SSD1306_SPRITE_CACHE_ENTRIES 4
+#endif
+
+#if defined SSD1306_TEXT_CACHE && !defined SSD1306_TEXT_CACHE_ENTRIES
+  #define SSD1306_TEXT_CACHE_ENTRIES 2
+#endif
+#if defined SSD1306_TEXT_CACHE && !defined SSD1306_TEXT_CACHE_LENGTH
+  #define SSD1306_TEXT_CACHE_LENGTH 4
+#endif
+
+#if defined SSD1306_PAGE_BUFFER && (defined SSD1306_DOUBLE_BUFFER || defined SSD1306_TWI_ASYNC)
+  #error "SSD1306_PAGE_BUFFER cannot be combined with SSD1306_DOUBLE_BUFFER or SSD1306_TWI_ASYNC"
+#endif
+
+#if defined SSD1306_TWI_ASYNC && !defined SSD1306_TWI_DIRECT
+  #define SSD1306_TWI_DIRECT
+#endif
+#if defined SSD1306_TWI_DIRECT && !defined TWBR
+  #error "SSD1306_TWI_DIRECT needs an AVR with a TWI peripheral"
+#endif
+
 #if defined SSD1306_128_64 && defined SSD1306_128_32
   #error "Only one SSD1306 display can be specified at once in SSD1306.h"
 #endif
@@ -92,6 +238,32 @@ All text above, and the splash screen must be included in any redistribution
   #define SSD1306_LCDHEIGHT                 16
 #endif
 
+#define SSD1306_CHUNK_SIZE 16 // bytes per I2C data transmission and per shadow frame CRC
+#define SSD1306_CHUNKS_PER_PAGE (SSD1306_LCDWIDTH/SSD1306_CHUNK_SIZE)
+#define SSD1306_CHUNKS (SSD1306_CHUNKS_PER_PAGE*SSD1306_LCDHEIGHT/8)
+
+#if defined SSD1306_DOUBLE_BUFFER && defined RAMEND && defined RAMSTART
+  #if (RAMEND - RAMSTART + 1) < (2 * SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8) + 512
+    #error "Not enough RAM for SSD1306_DOUBLE_BUFFER on this board"
+  #endif
+#endif
+
+#if defined SSD1306_128_64
+  #define SSD1306_COMPINS                   0x12
+  #define SSD1306_CONTRAST_EXTERNALVCC      0x9F
+  #define SSD1306_CONTRAST_SWITCHCAPVCC     0xCF
+#endif
+#if defined SSD1306_128_32
+  #define SSD1306_COMPINS                   0x02
+  #define SSD1306_CONTRAST_EXTERNALVCC      0x8F
+  #define SSD1306_CONTRAST_SWITCHCAPVCC     0x8F
+#endif
+#if defined SSD1306_96_16
+  #define SSD1306_COMPINS                   0x02 //ada x12
+  #define SSD1306_CONTRAST_EXTERNALVCC      0x10
+  #define SSD1306_CONTRAST_SWITCHCAPVCC     0xAF
+#endif
+
 #define SSD1306_SETCONTRAST 0x81
 #define SSD1306_DISPLAYALLON_RESUME 0xA4
 #define SSD1306_DISPLAYALLON 0xA5
@@ -138,7 +310,9 @@ All text above, and the splash screen must be included in any redistribution
 #define SSD1306_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29
 #define SSD1306_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL 0x2A
 
-class Adafruit_SSD1306 : public Adafruit_GFX {
+// final, so the GFX primitives instantiated for it call drawPixel() and the
+// fast lines directly rather than through the vtable
+class Adafruit_SSD1306 final : public Adafruit_GFX_Fast<Adafruit_SSD1306> {
  public:
   Adafruit_SSD1306(int8_t SID, int8_t SCLK, int8_t DC, int8_t RST, int8_t CS);
   Adafruit_SSD1306(int8_t DC, int8_t RST, int8_t CS);
@@ -146,11 +320,33 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
 
   void begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = SSD1306_I2C_ADDRESS, bool reset=true);
   void ssd1306_command(uint8_t c);
+  // send n command bytes in as few transactions as possible, from RAM or PROGMEM
+  void ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void ssd1306_commandList_P(const uint8_t *c, uint8_t n);
 
   void clearDisplay(void);
+  // make clearDisplay() restore a full-panel image from PROGMEM, laid out
+  // like the buffer (unrotated), instead of clearing to black; NULL undoes it
+  void setBackground(const uint8_t *layer);
+  // clear a rectangle back to that background, or to black without one
+  void clearRect(int16_t x, int16_t y, int16_t w, int16_t h);
   void invertDisplay(uint8_t i);
   void display();
 
+  // start sending the buffer and return straight away.  Drawing before
+  // waitFlush() may put a half-drawn frame on the panel, but whatever it
+  // changed is sent again by the next flush (with SSD1306_SHADOW_FRAME,
+  // the chunks it touched are resent whatever their CRC).
+  // Without SSD1306_TWI_ASYNC (or when using SPI) this is plain display().
+  void displayAsync(void);
+  boolean isFlushing(void);
+  void waitFlush(void);
+
+  // picture loop, see SSD1306_PAGE_BUFFER; without it the loop body runs
+  // once, between clearDisplay() and display()
+  void firstPage(void);
+  boolean nextPage(void);
+
   void startscrollright(uint8_t start, uint8_t stop);
   void startscrollleft(uint8_t start, uint8_t stop);
 
@@ -160,14 +356,61 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
 
   void dim(boolean dim);
 
+  // number of unchanged chunks the last display() did not send (always 0 without SSD1306_SHADOW_FRAME)
+  uint8_t getSkippedChunks(void) const;
+
   void drawPixel(int16_t x, int16_t y, uint16_t color);
 
+  // draw a w x h sprite from PROGMEM, stored like the buffer: a byte per
+  // column for each 8 rows (bit 0 at the top), page after page, with the
+  // bits below row h clear.  WHITE sets its pixels, BLACK clears them and
+  // INVERSE flips them; the rest of the buffer is left alone.
+  void drawSprite(int16_t x, int16_t y, const uint8_t *sprite, uint8_t w, uint8_t h, uint16_t color);
+
+  // draw a w x h bitmap from PROGMEM in the sprite format above (see
+  // tools/bitmap_convert.py) with a raster op: SSD1306_COPY replaces the
+  // rectangle, SSD1306_OR sets the bitmap's pixels, SSD1306_AND clears the
+  // pixels it does not have and SSD1306_XOR flips its pixels.  Unshifted
+  // whole pages with SSD1306_COPY are copied straight from flash.
+  void drawPageBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t op);
+
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 
+  // rectangles written a page byte at a time instead of column by column
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillScreen(uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  // lines and circles that lie wholly on the unrotated panel are drawn
+  // straight into the buffer, anything else goes through drawPixel()
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+
+  // unrotated, the rows are stored straight into the buffer as masked bytes
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+
+  // text in the classic font at sizes 1-4, unrotated, is stored a glyph
+  // column (one byte of the font, stretched for larger sizes) at a time,
+  // split over the pages it covers; so is text at size 1 in a font stored
+  // with GFXFONT_PAGES or GFXFONT_RLE, whose bytes are already columns;
+  // other text is drawn by Adafruit_GFX
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+
+  // draw one line of text with its top left at (x, y), in the classic font
+  // with the current text size and colours, without moving the cursor or
+  // wrapping; slot is the SSD1306_TEXT_CACHE entry to keep it in, one per
+  // piece of text that is redrawn every frame
+  void drawCachedText(uint8_t slot, int16_t x, int16_t y, const char *text);
+
+#ifdef SSD1306_ROTATION
+  void setRotation(uint8_t r) = delete; // fixed by SSD1306_ROTATION
+#endif
+
  private:
   int8_t _i2caddr, _vccstate, sid, sclk, dc, rst, cs;
   void fastSPIwrite(uint8_t c);
+  void commandList(const uint8_t *c, uint8_t n, boolean progmem);
 
   boolean hwSPI;
 #ifdef HAVE_PORTREG
@@ -177,6 +420,27 @@ class Adafruit_SSD1306 : public Adafruit_GFX {
 
   inline void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color) __attribute__((always_inline));
   inline void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) __attribute__((always_inline));
+  inline void fillRectInternal(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) __attribute__((always_inline));
+  inline void rotateRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h) __attribute__((always_inline));
+
+  // bounding box (columns x pages) of the buffer changed since the last display()
+  uint8_t dirtyX0, dirtyX1, dirtyPage0, dirtyPage1;
+  inline void markDirty(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) __attribute__((always_inline));
+  void markAllDirty(void);
+#ifdef SSD1306_TWI_DIRECT
+  void recoverTwi(void);
+#endif
+
+  uint8_t skippedChunks;
+  const uint8_t *background;
+#ifdef SSD1306_SHADOW_FRAME
+  boolean shadowValid;
+  uint8_t shadowAge; // flushes since everything was last sent regardless
+#endif
+  boolean prepareFlush(void);
+  void sendWindow(uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1);
+  void blitText(int16_t x, int16_t y, const uint8_t *src, uint8_t w, uint8_t pages, uint16_t color, uint16_t bg);
+  void drawPageGlyph(int16_t x, int16_t y, unsigned char c, uint16_t color);
 
 };
 
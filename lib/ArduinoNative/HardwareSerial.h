@@ -0,0 +1,21 @@
+// Serial shim: everything written goes to stdout so binary records can be
+// piped straight into a host-side decoder.
+#ifndef _NATIVE_HARDWARESERIAL_H_
+#define _NATIVE_HARDWARESERIAL_H_
+
+#include "Print.h"
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud);
+  void end(void);
+  void flush(void);
+  size_t write(uint8_t);
+  size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // _NATIVE_HARDWARESERIAL_H_
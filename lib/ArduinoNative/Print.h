@@ -0,0 +1,41 @@
+// Subset of the Arduino Print class used by Adafruit_GFX and the game.
+#ifndef _NATIVE_PRINT_H_
+#define _NATIVE_PRINT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+class __FlashStringHelper;
+
+#define DEC 10
+#define HEX 16
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  size_t write(const char *str);
+
+  size_t print(const __FlashStringHelper *);
+  size_t print(const char[]);
+  size_t print(char);
+  size_t print(int, int = DEC);
+  size_t print(unsigned int, int = DEC);
+  size_t print(long, int = DEC);
+  size_t print(unsigned long, int = DEC);
+
+  size_t println(const __FlashStringHelper *);
+  size_t println(const char[]);
+  size_t println(char);
+  size_t println(int, int = DEC);
+  size_t println(unsigned int, int = DEC);
+  size_t println(long, int = DEC);
+  size_t println(unsigned long, int = DEC);
+  size_t println(void);
+
+ private:
+  size_t printNumber(unsigned long, uint8_t);
+};
+
+#endif // _NATIVE_PRINT_H_
@@ -0,0 +1,20 @@
+// SPI shim: the game drives the panel over I2C, so transfers are discarded.
+#ifndef _NATIVE_SPI_H_
+#define _NATIVE_SPI_H_
+
+#include <stdint.h>
+
+#define SPI_MODE0 0x00
+#define MSBFIRST  1
+
+class SPIClass {
+ public:
+  void begin(void) {}
+  void end(void) {}
+  void setClockDivider(uint8_t) {}
+  uint8_t transfer(uint8_t) { return 0; }
+};
+
+extern SPIClass SPI;
+
+#endif // _NATIVE_SPI_H_
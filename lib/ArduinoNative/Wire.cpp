@@ -0,0 +1,34 @@
+#include "Wire.h"
+#include "ssd1306_model.h"
+
+TwoWire Wire;
+
+void TwoWire::begin(void) {
+	txLength = 0;
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+	txAddress = address;
+	txLength = 0;
+}
+
+uint8_t TwoWire::endTransmission(void) {
+	model_transaction(txAddress, txBuffer, txLength);
+	txLength = 0;
+	return 0;
+}
+
+size_t TwoWire::write(uint8_t data) {
+	if (txLength >= BUFFER_LENGTH)
+		return 0;
+	txBuffer[txLength++] = data;
+	return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+	for (size_t i = 0; i < quantity; i++) {
+		if (!write(data[i]))
+			return i;
+	}
+	return quantity;
+}
@@ -0,0 +1,32 @@
+// Wire shim.  Every transmitted byte is handed to the SSD1306 panel model
+// (ssd1306_model.h), which rebuilds the on-glass image and keeps bus
+// statistics.  Like the AVR Wire library, a transmission holds at most
+// BUFFER_LENGTH bytes and anything beyond that is dropped.
+#ifndef _NATIVE_WIRE_H_
+#define _NATIVE_WIRE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Print.h"
+
+#define BUFFER_LENGTH 32
+
+class TwoWire : public Print {
+ public:
+  void begin(void);
+  void beginTransmission(uint8_t address);
+  void beginTransmission(int address) { beginTransmission((uint8_t)address); }
+  uint8_t endTransmission(void);
+  size_t write(uint8_t);
+  size_t write(const uint8_t *data, size_t quantity);
+  using Print::write;
+
+ private:
+  uint8_t txAddress;
+  uint8_t txBuffer[BUFFER_LENGTH];
+  uint8_t txLength;
+};
+
+extern TwoWire Wire;
+
+#endif // _NATIVE_WIRE_H_
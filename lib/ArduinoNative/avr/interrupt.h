@@ -0,0 +1,9 @@
+#ifndef _NATIVE_AVR_INTERRUPT_H_
+#define _NATIVE_AVR_INTERRUPT_H_
+
+#include "avr_registers.h"
+
+#define sei()
+#define cli()
+
+#endif // _NATIVE_AVR_INTERRUPT_H_
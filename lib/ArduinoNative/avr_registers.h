@@ -0,0 +1,63 @@
+// ATmega328P ADC and TWI registers and ISR() as used by src/arduino_pong.cpp
+// and the SSD1306 driver.  The ADC registers are plain variables; the
+// native runner writes ADCL/ADCH and calls the ADC_vect handler itself to
+// simulate the paddle pot.  The TWI registers are mocked in twi_mock.cpp.
+#ifndef _NATIVE_AVR_REGISTERS_H_
+#define _NATIVE_AVR_REGISTERS_H_
+
+#include <stdint.h>
+
+extern volatile uint8_t ADCSRA, ADCSRB, ADMUX, ADCL, ADCH;
+
+// ADMUX
+#define REFS1 7
+#define REFS0 6
+#define ADLAR 5
+
+// ADCSRA
+#define ADEN  7
+#define ADSC  6
+#define ADATE 5
+#define ADIF  4
+#define ADIE  3
+#define ADPS2 2
+#define ADPS1 1
+#define ADPS0 0
+
+#define F_CPU 16000000UL
+#define _BV(bit) (1 << (bit))
+
+// Two-wire interface.  Writing TWCR runs the operation it asks for
+// against the panel model at once and sets TWINT, so polled code never
+// waits; with TWIE set it also raises TWI_vect (see twi_mock.h).
+class TwcrRegister {
+ public:
+	operator uint8_t() const { return value; }
+	TwcrRegister &operator=(uint8_t control);
+
+ private:
+	uint8_t value;
+};
+
+extern TwcrRegister TWCR;
+extern volatile uint8_t TWBR, TWSR, TWDR;
+#define TWBR TWBR // for code that checks for a TWI with #ifdef TWBR
+
+// TWCR
+#define TWINT 7
+#define TWEA  6
+#define TWSTA 5
+#define TWSTO 4
+#define TWWC  3
+#define TWEN  2
+#define TWIE  0
+
+static const uint8_t SDA = 18;
+static const uint8_t SCL = 19;
+
+#define ISR(vector) extern "C" void vector(void)
+
+extern "C" void ADC_vect(void);
+extern "C" void TWI_vect(void);
+
+#endif // _NATIVE_AVR_REGISTERS_H_
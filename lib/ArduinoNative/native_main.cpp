@@ -0,0 +1,103 @@
+// Native entry point: runs the unmodified sketch headless.
+//
+//   platformio run -e native
+//   .pioenvs/native/program [frames] [pbm-directory]
+//
+// Runs setup() and then loop() 'frames' times (default 600), feeding the
+// paddle ADC with a slow triangle wave.  Simulated time advances with the
+// bus traffic and by NATIVE_LOOP_MICROS per loop().  Bus statistics are printed to
+// stderr when done; if a directory is given, the panel image is written
+// there as frame_NNNN.pbm after every loop().
+#include <stdio.h>
+#include "Arduino.h"
+#include "SPI.h"
+#include "ssd1306_model.h"
+
+volatile uint8_t ADCSRA, ADCSRB, ADMUX, ADCL, ADCH;
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+#ifndef NATIVE_LOOP_MICROS
+#define NATIVE_LOOP_MICROS 2000
+#endif
+
+static unsigned long nowMicros;
+static volatile uint8_t portSink;
+
+extern void setup(void);
+extern void loop(void);
+
+void native_advance_micros(unsigned long us) {
+	nowMicros += us;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+volatile uint8_t *portOutputRegister(uint8_t) { return &portSink; }
+uint8_t digitalPinToPort(uint8_t) { return 0; }
+uint8_t digitalPinToBitMask(uint8_t pin) { return 1 << (pin & 7); }
+
+unsigned long millis(void) { return nowMicros / 1000; }
+unsigned long micros(void) { return nowMicros; }
+void delay(unsigned long ms) { nowMicros += ms * 1000; }
+void delayMicroseconds(unsigned int us) { nowMicros += us; }
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+	return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+void HardwareSerial::begin(unsigned long) {}
+void HardwareSerial::end(void) {}
+void HardwareSerial::flush(void) { fflush(stdout); }
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+
+// under pio test the tests in test/ bring their own main()
+#ifndef UNIT_TEST
+
+// Conversion complete: latch a new pot reading the way the hardware would
+static void sampleAdc(unsigned long frame) {
+	unsigned long phase = frame % 256;
+	uint16_t value = (phase < 128 ? phase : 255 - phase) * 8;
+	ADCL = value & 0xFF;
+	ADCH = value >> 8;
+	ADC_vect();
+}
+
+int main(int argc, char **argv) {
+	unsigned long frames = (argc > 1) ? strtoul(argv[1], NULL, 10) : 600;
+	const char *pbmDir = (argc > 2) ? argv[2] : NULL;
+
+	setup();
+	model_reset_stats();
+
+	for (unsigned long frame = 0; frame < frames; frame++) {
+		sampleAdc(frame);
+		loop();
+		// the sketch's own work between flushes, so time passes even when nothing is sent
+		native_advance_micros(NATIVE_LOOP_MICROS);
+
+		if (pbmDir) {
+			char path[512];
+			snprintf(path, sizeof(path), "%s/frame_%04lu.pbm", pbmDir, frame);
+			if (!model_write_pbm(path)) {
+				fprintf(stderr, "cannot write %s\n", path);
+				return 1;
+			}
+		}
+	}
+
+	const ModelStats &s = model_stats();
+	fprintf(stderr, "frames:            %lu\n", frames);
+	fprintf(stderr, "simulated time:    %lu us\n", nowMicros);
+	if (frames) {
+		fprintf(stderr, "bytes/frame:       %lu\n", s.bytes / frames);
+		fprintf(stderr, "data bytes/frame:  %lu\n", s.dataBytes / frames);
+		fprintf(stderr, "cmd bytes/frame:   %lu\n", s.commandBytes / frames);
+		fprintf(stderr, "transactions/frame:%lu\n", s.transactions / frames);
+	}
+	return 0;
+}
+
+#endif // UNIT_TEST
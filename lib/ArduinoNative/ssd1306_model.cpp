@@ -0,0 +1,136 @@
+#include "ssd1306_model.h"
+#include "Arduino.h"
+
+static uint8_t gddram[MODEL_PAGES * MODEL_WIDTH];
+static ModelStats stats;
+
+// Address window and write pointer, as set by COLUMNADDR/PAGEADDR
+static uint8_t colStart = 0, colEnd = MODEL_WIDTH - 1;
+static uint8_t pageStart = 0, pageEnd = MODEL_PAGES - 1;
+static uint8_t col = 0, page = 0;
+
+// Command currently being decoded and the arguments collected so far
+static uint8_t cmd, cmdArgs[8], cmdArgCount, cmdArgsNeeded;
+
+// Advance the simulated clock by the bus time of 'bytes' bytes
+extern void native_advance_micros(unsigned long us);
+
+static uint8_t argsFor(uint8_t c) {
+	switch (c) {
+	case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+	case 0xD9: case 0xDA: case 0xDB: case 0x20:
+		return 1;
+	case 0x21: case 0x22: case 0xA3:
+		return 2;
+	case 0x29: case 0x2A:
+		return 5;
+	case 0x26: case 0x27:
+		return 6;
+	}
+	return 0;
+}
+
+static void runCommand(void) {
+	switch (cmd) {
+	case 0x21: // COLUMNADDR
+		colStart = cmdArgs[0] % MODEL_WIDTH;
+		colEnd = cmdArgs[1] % MODEL_WIDTH;
+		col = colStart;
+		break;
+	case 0x22: // PAGEADDR
+		pageStart = cmdArgs[0] % MODEL_PAGES;
+		pageEnd = cmdArgs[1] % MODEL_PAGES;
+		page = pageStart;
+		break;
+	}
+}
+
+static void command(uint8_t c) {
+	stats.commandBytes++;
+	if (cmdArgsNeeded) {
+		cmdArgs[cmdArgCount++] = c;
+		if (cmdArgCount == cmdArgsNeeded) {
+			cmdArgsNeeded = 0;
+			runCommand();
+		}
+		return;
+	}
+	cmd = c;
+	cmdArgCount = 0;
+	cmdArgsNeeded = argsFor(c);
+	if (!cmdArgsNeeded)
+		runCommand();
+}
+
+static void data(uint8_t d) {
+	stats.dataBytes++;
+	gddram[page * MODEL_WIDTH + col] = d;
+	if (col == colEnd) {
+		col = colStart;
+		page = (page == pageEnd) ? pageStart : page + 1;
+	} else {
+		col = (col + 1) % MODEL_WIDTH;
+	}
+}
+
+void model_begin(uint8_t address) {
+	(void)address;
+}
+
+void model_transaction(uint8_t address, const uint8_t *buf, uint16_t length) {
+	(void)address;
+	stats.transactions++;
+	stats.bytes += 1 + length;
+	// 9 clocks per byte plus roughly one byte time for start/stop
+	native_advance_micros(((2UL + length) * 9UL * 1000000UL) / MODEL_I2C_HZ);
+
+	// Control byte: Co (bit 7) selects a single pair, D/C# (bit 6) data
+	uint16_t i = 0;
+	while (i < length) {
+		uint8_t control = buf[i++];
+		bool isData = control & 0x40;
+		bool continuation = control & 0x80;
+		if (continuation) {
+			if (i < length) {
+				if (isData) data(buf[i++]);
+				else        command(buf[i++]);
+			}
+			continue;
+		}
+		for (; i < length; i++) {
+			if (isData) data(buf[i]);
+			else        command(buf[i]);
+		}
+	}
+}
+
+const uint8_t *model_gddram(void) {
+	return gddram;
+}
+
+const ModelStats &model_stats(void) {
+	return stats;
+}
+
+void model_reset_stats(void) {
+	memset(&stats, 0, sizeof(stats));
+}
+
+bool model_write_pbm(const char *path) {
+	FILE *f = fopen(path, "wb");
+	if (!f)
+		return false;
+	fprintf(f, "P4\n%d %d\n", MODEL_WIDTH, MODEL_PAGES * 8);
+	for (int y = 0; y < MODEL_PAGES * 8; y++) {
+		for (int x = 0; x < MODEL_WIDTH; x += 8) {
+			uint8_t out = 0;
+			for (int b = 0; b < 8; b++) {
+				if (gddram[(y / 8) * MODEL_WIDTH + x + b] & (1 << (y & 7)))
+					out |= 0x80 >> b;
+			}
+			fputc(out, f);
+		}
+	}
+	fclose(f);
+	return true;
+}
@@ -0,0 +1,33 @@
+// Host-side model of an SSD1306 panel on the I2C bus.  It decodes the
+// command/data stream the driver sends, keeps its own copy of GDDRAM and
+// counts what went over the wire, so a frame can be checked or dumped
+// without hardware.
+#ifndef _NATIVE_SSD1306_MODEL_H_
+#define _NATIVE_SSD1306_MODEL_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#define MODEL_WIDTH  128
+#define MODEL_PAGES  8
+
+// Simulated bus speed, matching the 400KHz the driver asks for
+#define MODEL_I2C_HZ 400000UL
+
+struct ModelStats {
+	unsigned long transactions;
+	unsigned long bytes;        // Everything on the wire, address bytes included
+	unsigned long dataBytes;    // GDDRAM writes only
+	unsigned long commandBytes; // Command and argument bytes
+};
+
+void model_begin(uint8_t address);
+void model_transaction(uint8_t address, const uint8_t *data, uint16_t length);
+
+const uint8_t *model_gddram(void);
+const ModelStats &model_stats(void);
+void model_reset_stats(void);
+
+bool model_write_pbm(const char *path);
+
+#endif // _NATIVE_SSD1306_MODEL_H_
@@ -0,0 +1,119 @@
+#include "Arduino.h"
+#include "twi_mock.h"
+#include "ssd1306_model.h"
+#include <util/twi.h>
+#include <stdio.h>
+
+TwcrRegister TWCR;
+volatile uint8_t TWBR, TWSR, TWDR;
+
+// For sketches that poll the TWI, the driver supplies the real one otherwise
+extern "C" void TWI_vect(void) __attribute__((weak));
+extern "C" void TWI_vect(void) {}
+
+// The transaction being sent: SLA+W and what followed it
+static uint8_t txBuffer[2048];
+static uint16_t txLength;
+static bool txOpen;
+
+static uint8_t logBuffer[4096];
+static uint16_t logLength;
+
+static bool held, pending, running;
+static long nackAfter = -1;
+
+static void endTransaction(void) {
+	if (txOpen && txLength)
+		model_transaction(txBuffer[0] >> 1, txBuffer + 1, txLength - 1);
+	txOpen = false;
+}
+
+static void transmit(uint8_t byte) {
+	if (!txOpen || txLength == sizeof(txBuffer)) {
+		fprintf(stderr, "twi_mock: TWDR sent outside a transaction\n");
+		abort();
+	}
+	txBuffer[txLength++] = byte;
+	if (logLength < sizeof(logBuffer))
+		logBuffer[logLength++] = byte;
+	if (txLength == 1) {
+		TWSR = TW_MT_SLA_ACK;
+	} else if (nackAfter == 0) {
+		TWSR = TW_MT_DATA_NACK;
+		nackAfter = -1;
+	} else {
+		TWSR = TW_MT_DATA_ACK;
+		if (nackAfter > 0)
+			nackAfter--;
+	}
+}
+
+static void runInterrupts(void) {
+	if (running)
+		return;
+	running = true;
+	while (pending && !held) {
+		pending = false;
+		TWI_vect();
+	}
+	running = false;
+}
+
+TwcrRegister &TwcrRegister::operator=(uint8_t control) {
+	// writing TWINT clears it and starts the operation
+	value = control & ~_BV(TWINT);
+	if (!(control & _BV(TWINT)))
+		return *this;
+
+	if (control & _BV(TWSTO)) {
+		// the hardware clears TWSTO once the STOP is out
+		endTransaction();
+		value &= ~_BV(TWSTO);
+	}
+	if (control & _BV(TWSTA)) {
+		TWSR = txOpen ? TW_REP_START : TW_START;
+		endTransaction();
+		txOpen = true;
+		txLength = 0;
+	} else if (control & _BV(TWSTO)) {
+		// a STOP on its own is done at once and raises no interrupt
+		return *this;
+	} else {
+		transmit(TWDR);
+	}
+	value |= _BV(TWINT);
+
+	if (control & _BV(TWIE)) {
+		pending = true;
+		runInterrupts();
+	}
+	return *this;
+}
+
+void twi_mock_hold(bool hold) {
+	held = hold;
+	runInterrupts();
+}
+
+bool twi_mock_step(void) {
+	if (!pending || running)
+		return false;
+	running = true;
+	pending = false;
+	TWI_vect();
+	running = false;
+	return true;
+}
+
+void twi_mock_nack_after(long bytes) {
+	nackAfter = bytes;
+}
+
+const uint8_t *twi_mock_log(uint16_t *length) {
+	*length = logLength;
+	return logBuffer;
+}
+
+void twi_mock_clear_log(void) {
+	logLength = 0;
+}
@@ -0,0 +1,31 @@
+// Mock of the ATmega328P two-wire interface (TWCR, TWSR, TWDR, TWBR in
+// avr_registers.h), driving the SSD1306 panel model.  Each transaction is
+// handed to model_transaction() when its STOP or repeated START is
+// written.
+//
+// By default an interrupt raised by a TWCR write runs as soon as that
+// write returns, so an interrupt-driven transfer completes inside the
+// call that started it.  Tests that need to look at, or draw during, a
+// transfer in flight can hold the interrupts and step through them.
+#ifndef _NATIVE_TWI_MOCK_H_
+#define _NATIVE_TWI_MOCK_H_
+
+#include <stdint.h>
+
+// While held, TWI_vect is only run by twi_mock_step(); releasing runs
+// whatever is pending until the bus is idle.  Anything that waits for
+// the transfer (waitFlush()) would spin forever while it is held.
+void twi_mock_hold(bool hold);
+
+// Run one pending TWI_vect, false if none is pending
+bool twi_mock_step(void);
+
+// NACK the data byte that follows the next 'bytes' acknowledged ones,
+// once; -1 cancels
+void twi_mock_nack_after(long bytes);
+
+// Every byte sent since the last twi_mock_clear_log(), SLA+W included
+const uint8_t *twi_mock_log(uint16_t *length);
+void twi_mock_clear_log(void);
+
+#endif // _NATIVE_TWI_MOCK_H_
@@ -0,0 +1,7 @@
+#ifndef _NATIVE_UTIL_DELAY_H_
+#define _NATIVE_UTIL_DELAY_H_
+
+#define _delay_ms(ms) ((void)(ms))
+#define _delay_us(us) ((void)(us))
+
+#endif // _NATIVE_UTIL_DELAY_H_
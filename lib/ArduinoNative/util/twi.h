@@ -0,0 +1,18 @@
+// TWI status codes from avr-libc, for the mock in twi_mock.cpp.
+#ifndef _NATIVE_UTIL_TWI_H_
+#define _NATIVE_UTIL_TWI_H_
+
+#include "avr_registers.h"
+
+#define TW_STATUS_MASK  0xF8
+#define TW_STATUS       (TWSR & TW_STATUS_MASK)
+
+#define TW_START        0x08
+#define TW_REP_START    0x10
+#define TW_MT_SLA_ACK   0x18
+#define TW_MT_SLA_NACK  0x20
+#define TW_MT_DATA_ACK  0x28
+#define TW_MT_DATA_NACK 0x30
+#define TW_MT_ARB_LOST  0x38
+
+#endif // _NATIVE_UTIL_TWI_H_
@@ -2,6 +2,8 @@
 /*----------------------------------Includes----------------------------------*/
 /******************************************************************************/
 #include <Adafruit_SSD1306.h>
+#include "profile.h"
+#include "benchmark.h"
 
 /******************************************************************************/
 /*-----------------------------------Macros-----------------------------------*/
@@ -18,12 +20,32 @@
 #define BALL_SIZE 4
 #define SPEED 5
 
+#define TICK_RATE 30		// game updates per second, independent of the frame rate
+#define MAX_CATCH_UP 4		// most updates run after one slow frame before time is dropped
+
 #define MAX_SCORE 9
 
+// erase and redraw only what moved instead of redrawing the whole frame;
+// needs the buffer to still hold the last frame, which it does not when
+// it is double buffered or drawn a page at a time
+#if !defined SSD1306_PAGE_BUFFER && !defined SSD1306_DOUBLE_BUFFER
+#define INCREMENTAL_RENDER
+#endif
+
+// build with -DPONG_PRIMITIVES to draw the ball and paddles with
+// drawCircle() and drawFastVLine() instead of sprites, so that the ball and
+// paddles stages of uno_profile_primitives and uno_profile can be compared
+
+#define SCORE_SIZE 2
+#define PLAYER_SCORE_COLUMN 45
+#define AI_SCORE_COLUMN 75
+#define PLAYER_SCORE_SLOT 0	// drawCachedText() slots
+#define AI_SCORE_SLOT 1
+
 /******************************************************************************/
 /*------------------------Private Variables/Constants-------------------------*/
 /******************************************************************************/
-const int RESOLUTION[2] = {128, 64};
+constexpr int RESOLUTION[2] = {128, 64};
 const int PLAYER_COLUMN = 0;
 const int AI_COLUMN = RESOLUTION[IDX_X] - PADDLE_WIDTH;
 
@@ -33,6 +55,28 @@ const int COLLISION_WIDTH = PADDLE_WIDTH + (BALL_SIZE / 2);
 const int PLAYER_RESET_POS[2] = {COLLISION_WIDTH, RESOLUTION[IDX_Y] / 2};
 const int AI_RESET_POS[2] = {RESOLUTION[IDX_X] - COLLISION_WIDTH, RESOLUTION[IDX_Y] / 2};
 
+const unsigned long TICK_MICROS = 1000000UL / TICK_RATE;
+
+const int NET_COLUMN = (RESOLUTION[IDX_X] / 2) - 1;
+
+// sprites in the panel's page format, a byte per column for each 8 rows, bit 0 at the top
+const uint8_t BALL_SPRITE_SIZE = (BALL_SIZE * 2) + 1;
+const uint8_t BALL_SPRITE[] PROGMEM =
+{
+	// a circle of radius BALL_SIZE, as drawCircle() draws it
+	0x38, 0xC6, 0x82, 0x01, 0x01, 0x01, 0x82, 0xC6, 0x38,
+	0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00
+};
+
+const uint8_t PADDLE_SPRITE_HEIGHT = PADDLE_WIDTH * PADDLE_HEIGHT;
+const uint8_t PADDLE_SPRITE[] PROGMEM =
+{
+	// solid, PADDLE_WIDTH wide and PADDLE_SPRITE_HEIGHT tall
+	0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF,
+	0x0F, 0x0F, 0x0F, 0x0F
+};
+
 /******************************************************************************/
 /*--------------------------------Enumerations--------------------------------*/
 /******************************************************************************/
@@ -79,6 +123,78 @@ typedef union
 	uint16_t V;
 } adcResult;
 
+typedef struct
+{
+	int x;
+	int y;
+	int w;
+	int h;
+} screenRect;
+
+typedef struct
+{
+	bool valid = false;	// nothing is on screen to build on yet
+	bool gameOver;
+	int ball[2];
+	int player;
+	int ai;
+	int playerScore;
+	int aiScore;
+} frameState;
+
+// the numbers 0..N-1 as a parameter pack, built by halves to keep the
+// template recursion shallow
+template<unsigned... I> struct indexList {};
+
+template<class A, class B> struct joinIndexLists;
+template<unsigned... A, unsigned... B> struct joinIndexLists<indexList<A...>, indexList<B...> >
+{
+	typedef indexList<A..., (sizeof...(A) + B)...> type;
+};
+
+template<unsigned N> struct makeIndexList
+{
+	typedef typename joinIndexLists<typename makeIndexList<N / 2>::type,
+		typename makeIndexList<N - (N / 2)>::type>::type type;
+};
+template<> struct makeIndexList<0> { typedef indexList<> type; };
+template<> struct makeIndexList<1> { typedef indexList<0> type; };
+
+/******************************************************************************/
+/*------------------------------Background layer------------------------------*/
+/******************************************************************************/
+// the net in the panel's page format, worked out by the compiler; the only
+// definition of where the net is, clearRect() restores it wherever the
+// ball or a paddle is wiped off it
+constexpr bool isNetColumn(int x)
+{
+	return (x >= NET_COLUMN) && (x < NET_COLUMN + WALL_WIDTH);
+}
+
+constexpr bool isNetRow(int y)
+{
+	return (y % (WALL_WIDTH * 2)) < WALL_WIDTH;
+}
+
+constexpr uint8_t netBits(int page, int bit)
+{
+	return (bit == 8) ? 0 : ((isNetRow((page * 8) + bit) ? (1 << bit) : 0) | netBits(page, bit + 1));
+}
+
+constexpr uint8_t netByte(unsigned i)
+{
+	return isNetColumn(i % RESOLUTION[IDX_X]) ? netBits(i / RESOLUTION[IDX_X], 0) : 0;
+}
+
+template<class L> struct netLayer;
+template<unsigned... I> struct netLayer<indexList<I...> >
+{
+	static const uint8_t bytes[sizeof...(I)];
+};
+template<unsigned... I> const uint8_t netLayer<indexList<I...> >::bytes[sizeof...(I)] PROGMEM = {netByte(I)...};
+
+typedef netLayer<makeIndexList<(RESOLUTION[IDX_X] * RESOLUTION[IDX_Y]) / 8>::type> NetLayer;
+
 /******************************************************************************/
 /*------------------------------Global variables------------------------------*/
 /******************************************************************************/
@@ -91,13 +207,31 @@ ballData ball;
 
 static volatile adcResult adc;
 
+static unsigned long nextTick;
+
+#ifdef INCREMENTAL_RENDER
+static frameState drawn;
+#endif
+
 /******************************************************************************/
 /*-------------------------Function Prototypes--------------------------------*/
 /******************************************************************************/
+bool isGameOver();
+void updateGame();
 void moveAi();
+void drawFrame(bool gameOver);
+#ifdef INCREMENTAL_RENDER
+void drawChanges(bool gameOver);
+#endif
+bool overlapsAny(const screenRect &r, const screenRect *areas, uint8_t count);
+screenRect ballRect(int x, int y);
+screenRect paddleRect(int column, int row);
+screenRect scoreRect(int column, int score);
 void drawScore();
-void drawNet();
+const char *scoreText(char *text, int score);
+#ifdef PONG_PRIMITIVES
 void drawBlock(int posX, int posY, int height, int width);
+#endif
 void drawPaddle(int column, int row);
 void drawBall(int x, int y);
 void checkGoal(playerData *check, playerData *other);
@@ -125,15 +259,139 @@ void setup()
 	ADCSRA |= (1 << ADSC);	// start ADC measurements
 
 	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
-	display.clearDisplay();
-	display.display();
+
+	// blank the panel
+	display.firstPage();
+	while (display.nextPage());
+
+	profileBegin();
+#ifdef PONG_BENCH
+	benchmarkRun(display);
+#endif
+	nextTick = micros();
 }
 
 void loop()
 {
+	// run the game updates that have fallen due since the last frame
+	unsigned long now = micros();
+	uint8_t ticks = 0;
+	while ((long)(now - nextTick) >= 0)
+	{
+		if (ticks == MAX_CATCH_UP)
+		{
+			// too far behind, slow the game down rather than stall the display
+			nextTick = now + TICK_MICROS;
+			break;
+		}
+
+		PROFILE_BEGIN(Stage_Physics);
+		updateGame();
+		PROFILE_END(Stage_Physics);
+		nextTick += TICK_MICROS;
+		ticks++;
+	}
+
+	if (ticks == 0)
+	{
+		// nothing has moved since the last frame
+		return;
+	}
+
+	bool gameOver = isGameOver();
+
+	// the net is part of the background until somebody has won
+	display.setBackground(gameOver ? NULL : NetLayer::bytes);
+
+#ifdef SSD1306_PAGE_BUFFER
+	// draw the frame once for each page, every page goes out as soon as it is done
+	display.firstPage();
+	do
+	{
+		drawFrame(gameOver);
+	}
+	while (display.nextPage());
+#else
+#ifndef SSD1306_DOUBLE_BUFFER
+	// the previous frame may still be going out, leave the buffer alone until it has
+	PROFILE_BEGIN(Stage_Wait);
+	display.waitFlush();
+	PROFILE_END(Stage_Wait);
+#endif
+#ifdef INCREMENTAL_RENDER
+	drawChanges(gameOver);
+#else
+	PROFILE_BEGIN(Stage_Clear);
 	display.clearDisplay();
+	PROFILE_END(Stage_Clear);
+
+	drawFrame(gameOver);
+#endif
+
+	// returns straight away when the driver can flush from the TWI interrupt
+	PROFILE_BEGIN(Stage_Display);
+	display.displayAsync();
+	PROFILE_END(Stage_Display);
+#endif
+
+	PROFILE_FRAME();
+}
+
+bool isGameOver()
+{
+	return (ai.score > MAX_SCORE || player.score > MAX_SCORE);
+}
+
+void updateGame()
+{
+	if (isGameOver())
+	{
+		return;
+	}
+
+	// move ball up vertically
+	ball.position[IDX_Y] = ball.position[IDX_Y] + (SPEED * ball.dirVert);
+	if (ball.position[IDX_Y] <= 0)
+	{
+		// bounce the ball off the top
+		ball.dirVert = VtDir_Down;
+	}
+	if (ball.position[IDX_Y] >= RESOLUTION[IDX_Y])
+	{
+		// bounce the ball off the bottom
+		ball.dirVert = VtDir_Up;
+	}
+
+	// move ball horizontally
+	ball.position[IDX_X] = ball.position[IDX_X] + (SPEED * ball.dirHori);
+	if (ball.dirHori == HzDir_Right)
+	{
+		if (ball.position[IDX_X] >= (RESOLUTION[IDX_X] - COLLISION_WIDTH))
+		{
+			// ball is at the AI edge of the screen
+			PROFILE_BEGIN(Stage_Goal);
+			checkGoal(&ai, &player);
+			PROFILE_END(Stage_Goal);
+		}
+	}
+	else if (ball.dirHori == HzDir_Left)
+	{
+		if (ball.position[IDX_X] <= COLLISION_WIDTH)
+		{
+			// ball is at the player edge of the screen
+			PROFILE_BEGIN(Stage_Goal);
+			checkGoal(&player, &ai);
+			PROFILE_END(Stage_Goal);
+		}
+	}
+
+	player.position = map(adc.V, 0, 1023, 8, 54); // convert value from 0 - 1023 to 8 - 54
+	moveAi();
+}
 
-	if (ai.score > MAX_SCORE || player.score > MAX_SCORE)
+void drawFrame(bool gameOver)
+{
+	if (gameOver)
 	{
 		// somebody has won
 		display.setTextSize(4);
@@ -152,51 +410,21 @@ void loop()
 	}
 	else
 	{
-		// move ball up vertically
-		ball.position[IDX_Y] = ball.position[IDX_Y] + (SPEED * ball.dirVert);
-		if (ball.position[IDX_Y] <= 0)
-		{
-			// bounce the ball off the top
-			ball.dirVert = VtDir_Down;
-		}
-		if (ball.position[IDX_Y] >= RESOLUTION[IDX_Y])
-		{
-			// bounce the ball off the bottom
-			ball.dirVert = VtDir_Up;
-		}
-
-		// move ball horizontally
-		ball.position[IDX_X] = ball.position[IDX_X] + (SPEED * ball.dirHori);
-		if (ball.dirHori == HzDir_Right)
-		{
-			if (ball.position[IDX_X] >= (RESOLUTION[IDX_X] - COLLISION_WIDTH))
-			{
-				// ball is at the AI edge of the screen
-				checkGoal(&ai, &player);
-			}
-		}
-		else if (ball.dirHori == HzDir_Left)
-		{
-			if (ball.position[IDX_X] <= COLLISION_WIDTH)
-			{
-				// ball is at the player edge of the screen
-				checkGoal(&player, &ai);
-			}
-		}
-
+		PROFILE_BEGIN(Stage_Ball);
 		drawBall(ball.position[IDX_X], ball.position[IDX_Y]);
+		PROFILE_END(Stage_Ball);
 
-		player.position = map(adc.V, 0, 1023, 8, 54); // convert value from 0 - 1023 to 8 - 54
+		PROFILE_BEGIN(Stage_Paddles);
 		drawPaddle(PLAYER_COLUMN, player.position);
-
-		moveAi();
 		drawPaddle(AI_COLUMN, ai.position);
+		PROFILE_END(Stage_Paddles);
 
-		drawNet();
+		// the net comes with the background
+
+		PROFILE_BEGIN(Stage_Score);
 		drawScore();
+		PROFILE_END(Stage_Score);
 	}
-
-	display.display();
 }
 
 void moveAi()
@@ -211,26 +439,119 @@ void moveAi()
 	}
 }
 
+#ifdef INCREMENTAL_RENDER
+void drawChanges(bool gameOver)
+{
+	if (!drawn.valid || (gameOver != drawn.gameOver))
+	{
+		// nothing to build on
+		PROFILE_BEGIN(Stage_Clear);
+		display.clearDisplay();
+		PROFILE_END(Stage_Clear);
+
+		drawFrame(gameOver);
+	}
+	else if (!gameOver)
+	{
+		bool ballMoved = (ball.position[IDX_X] != drawn.ball[IDX_X]) || (ball.position[IDX_Y] != drawn.ball[IDX_Y]);
+		bool playerMoved = (player.position != drawn.player);
+		bool aiMoved = (ai.position != drawn.ai);
+		bool scoreChanged = (player.score != drawn.playerScore) || (ai.score != drawn.aiScore);
+
+		// wipe everything that moved from where it was drawn, back to the background
+		screenRect erased[5];
+		uint8_t count = 0;
+		if (ballMoved)
+		{
+			erased[count++] = ballRect(drawn.ball[IDX_X], drawn.ball[IDX_Y]);
+		}
+		if (playerMoved)
+		{
+			erased[count++] = paddleRect(PLAYER_COLUMN, drawn.player);
+		}
+		if (aiMoved)
+		{
+			erased[count++] = paddleRect(AI_COLUMN, drawn.ai);
+		}
+		if (scoreChanged)
+		{
+			erased[count++] = scoreRect(PLAYER_SCORE_COLUMN, drawn.playerScore);
+			erased[count++] = scoreRect(AI_SCORE_COLUMN, drawn.aiScore);
+		}
+
+		PROFILE_BEGIN(Stage_Clear);
+		for (uint8_t i = 0; i < count; i++)
+		{
+			display.clearRect(erased[i].x, erased[i].y, erased[i].w, erased[i].h);
+		}
+		PROFILE_END(Stage_Clear);
+
+		// then draw what moved, and whatever the wiping cut into; everything is
+		// drawn in WHITE, so drawing it again over itself changes nothing
+		PROFILE_BEGIN(Stage_Ball);
+		if (ballMoved || overlapsAny(ballRect(ball.position[IDX_X], ball.position[IDX_Y]), erased, count))
+		{
+			drawBall(ball.position[IDX_X], ball.position[IDX_Y]);
+		}
+		PROFILE_END(Stage_Ball);
+
+		PROFILE_BEGIN(Stage_Paddles);
+		if (playerMoved || overlapsAny(paddleRect(PLAYER_COLUMN, player.position), erased, count))
+		{
+			drawPaddle(PLAYER_COLUMN, player.position);
+		}
+		if (aiMoved || overlapsAny(paddleRect(AI_COLUMN, ai.position), erased, count))
+		{
+			drawPaddle(AI_COLUMN, ai.position);
+		}
+		PROFILE_END(Stage_Paddles);
+
+		PROFILE_BEGIN(Stage_Score);
+		if (scoreChanged ||
+			overlapsAny(scoreRect(PLAYER_SCORE_COLUMN, player.score), erased, count) ||
+			overlapsAny(scoreRect(AI_SCORE_COLUMN, ai.score), erased, count))
+		{
+			drawScore();
+		}
+		PROFILE_END(Stage_Score);
+	}
+
+	drawn.valid = true;
+	drawn.gameOver = gameOver;
+	drawn.ball[IDX_X] = ball.position[IDX_X];
+	drawn.ball[IDX_Y] = ball.position[IDX_Y];
+	drawn.player = player.position;
+	drawn.ai = ai.position;
+	drawn.playerScore = player.score;
+	drawn.aiScore = ai.score;
+}
+#endif
+
 void drawScore()
 {
-	// draw AI and player scores
-	display.setTextSize(2);
-	display.setTextColor(WHITE);
-	display.setCursor(45, 0);
-	display.println(player.score);
+	char text[3];
 
-	display.setCursor(75, 0);
-	display.println(ai.score);
+	// draw AI and player scores, the display keeps them rendered until they change
+	display.setTextSize(SCORE_SIZE);
+	display.setTextColor(WHITE);
+	display.drawCachedText(PLAYER_SCORE_SLOT, PLAYER_SCORE_COLUMN, 0, scoreText(text, player.score));
+	display.drawCachedText(AI_SCORE_SLOT, AI_SCORE_COLUMN, 0, scoreText(text, ai.score));
 }
 
-void drawNet()
+const char *scoreText(char *text, int score)
 {
-	for (int i = 0; i < (RESOLUTION[IDX_Y] / WALL_WIDTH); i++)
+	// at most two digits, as scoreRect() assumes
+	char *p = text;
+	if (score >= 10)
 	{
-		drawBlock((RESOLUTION[IDX_X] / 2) - 1, WALL_WIDTH * i * 2, WALL_WIDTH, WALL_WIDTH);
+		*p++ = '0' + score / 10;
 	}
+	*p++ = '0' + score % 10;
+	*p = '\0';
+	return text;
 }
 
+#ifdef PONG_PRIMITIVES
 void drawBlock(int posX, int posY, int height, int width)
 {
 	// draw group of pixels
@@ -239,15 +560,57 @@ void drawBlock(int posX, int posY, int height, int width)
 		display.drawFastVLine(i, posY, height, WHITE);
 	}
 }
+#endif
 
 void drawPaddle(int column, int row)
 {
-	drawBlock(column, row - (PADDLE_WIDTH * 2), PADDLE_WIDTH * PADDLE_HEIGHT, PADDLE_WIDTH);
+#ifdef PONG_PRIMITIVES
+	drawBlock(column, row - (PADDLE_WIDTH * 2), PADDLE_SPRITE_HEIGHT, PADDLE_WIDTH);
+#else
+	display.drawSprite(column, row - (PADDLE_WIDTH * 2), PADDLE_SPRITE, PADDLE_WIDTH, PADDLE_SPRITE_HEIGHT, WHITE);
+#endif
 }
 
 void drawBall(int x, int y)
 {
+#ifdef PONG_PRIMITIVES
 	display.drawCircle(x, y, BALL_SIZE, WHITE);
+#else
+	display.drawSprite(x - BALL_SIZE, y - BALL_SIZE, BALL_SPRITE, BALL_SPRITE_SIZE, BALL_SPRITE_SIZE, WHITE);
+#endif
+}
+
+bool overlapsAny(const screenRect &r, const screenRect *areas, uint8_t count)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		if ((r.x < areas[i].x + areas[i].w) && (areas[i].x < r.x + r.w) &&
+			(r.y < areas[i].y + areas[i].h) && (areas[i].y < r.y + r.h))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+screenRect ballRect(int x, int y)
+{
+	screenRect r = {x - BALL_SIZE, y - BALL_SIZE, BALL_SPRITE_SIZE, BALL_SPRITE_SIZE};
+	return r;
+}
+
+screenRect paddleRect(int column, int row)
+{
+	screenRect r = {column, row - (PADDLE_WIDTH * 2), PADDLE_WIDTH, PADDLE_SPRITE_HEIGHT};
+	return r;
+}
+
+screenRect scoreRect(int column, int score)
+{
+	// 6x8 characters, scaled
+	int digits = (score >= 10) ? 2 : 1;
+	screenRect r = {column, 0, digits * 6 * SCORE_SIZE, 8 * SCORE_SIZE};
+	return r;
 }
 
 void checkGoal(playerData *check, playerData *other)
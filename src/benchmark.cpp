@@ -0,0 +1,103 @@
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "benchmark.h"
+
+#ifdef PONG_BENCH
+
+#ifndef PONG_PROFILE
+#error "PONG_BENCH times with the profiler's clock, build with PONG_PROFILE too"
+#endif
+
+#include "profile.h"
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define BENCH_PERIOD_MS 5000
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+// the primitives as they were before they became templates, every pixel
+// and line through the vtable
+typedef Adafruit_GFX_Core<Adafruit_GFX> GenericCore;
+
+// the same code instantiated for the display, with the calls bound statically
+typedef Adafruit_GFX_Core<Adafruit_SSD1306> DisplayCore;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+template<class Draw> static uint32_t cyclesPerCall(Adafruit_SSD1306 &display, Draw draw);
+static void printRow(const __FlashStringHelper *name, unsigned long generic, unsigned long core, unsigned long own);
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+void benchmarkRun(Adafruit_SSD1306 &display)
+{
+	Adafruit_GFX &gfx = display;
+
+	while (true)
+	{
+		Serial.println(F("cycles per call: generic GFX, GFX core for the display, display's own"));
+
+		printRow(F("fillRect 40x20"),
+			cyclesPerCall(display, [&] { GenericCore::fillRect(gfx, 10, 10, 40, 20, WHITE); }),
+			cyclesPerCall(display, [&] { DisplayCore::fillRect(display, 10, 10, 40, 20, WHITE); }),
+			cyclesPerCall(display, [&] { display.fillRect(10, 10, 40, 20, WHITE); }));
+
+		printRow(F("drawLine 127x40"),
+			cyclesPerCall(display, [&] { GenericCore::drawLine(gfx, 0, 0, 127, 40, WHITE); }),
+			cyclesPerCall(display, [&] { DisplayCore::drawLine(display, 0, 0, 127, 40, WHITE); }),
+			cyclesPerCall(display, [&] { display.drawLine(0, 0, 127, 40, WHITE); }));
+
+		printRow(F("fillTriangle"),
+			cyclesPerCall(display, [&] { GenericCore::fillTriangle(gfx, 10, 5, 100, 30, 40, 60, WHITE); }),
+			cyclesPerCall(display, [&] { DisplayCore::fillTriangle(display, 10, 5, 100, 30, 40, 60, WHITE); }),
+			cyclesPerCall(display, [&] { display.fillTriangle(10, 5, 100, 30, 40, 60, WHITE); }));
+
+		printRow(F("drawCircle r20"),
+			cyclesPerCall(display, [&] { GenericCore::drawCircle(gfx, 64, 32, 20, WHITE); }),
+			cyclesPerCall(display, [&] { DisplayCore::drawCircle(display, 64, 32, 20, WHITE); }),
+			cyclesPerCall(display, [&] { display.drawCircle(64, 32, 20, WHITE); }));
+
+		// at size 1 the generic glyph is drawn a pixel at a time; larger sizes
+		// fill each pixel's square with fillRect(), which the vtable sends to
+		// the display's page-byte version, not the generic code this row is for
+		printRow(F("drawChar size 1"),
+			cyclesPerCall(display, [&] { GenericCore::drawChar(gfx, 50, 20, 'A', WHITE, BLACK, 1); }),
+			cyclesPerCall(display, [&] { DisplayCore::drawChar(display, 50, 20, 'A', WHITE, BLACK, 1); }),
+			cyclesPerCall(display, [&] { display.drawChar(50, 20, 'A', WHITE, BLACK, 1); }));
+
+		Serial.println();
+		delay(BENCH_PERIOD_MS);
+	}
+}
+
+template<class Draw> static uint32_t cyclesPerCall(Adafruit_SSD1306 &display, Draw draw)
+{
+	// into the buffer only, nothing is sent
+	display.clearDisplay();
+
+	uint32_t start = profileNow();
+	for (uint8_t i = 0; i < BENCH_RUNS; i++)
+	{
+		draw();
+	}
+	return (profileNow() - start) / BENCH_RUNS;
+}
+
+static void printRow(const __FlashStringHelper *name, unsigned long generic, unsigned long core, unsigned long own)
+{
+	Serial.print(name);
+	Serial.print('\t');
+	Serial.print(generic);
+	Serial.print('\t');
+	Serial.print(core);
+	Serial.print('\t');
+	Serial.println(own);
+}
+
+#endif // PONG_BENCH
@@ -0,0 +1,27 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Adafruit_SSD1306.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+// Build with -DPONG_BENCH (and PONG_PROFILE, for its Timer1 clock) to turn
+// the sketch into a benchmark of the drawing primitives: instead of the
+// game, a table of CPU cycles per call is printed over Serial every few
+// seconds.  Each primitive is timed three ways, see benchmark.cpp.
+#ifndef BENCH_RUNS
+#define BENCH_RUNS 32
+#endif
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+#ifdef PONG_BENCH
+void benchmarkRun(Adafruit_SSD1306 &display);	// does not return
+#endif
+
+#endif // BENCHMARK_H
@@ -0,0 +1,151 @@
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include "profile.h"
+
+#ifdef PONG_PROFILE
+
+#include <avr/interrupt.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+#define RECORD_SYNC_0 0xA5
+#define RECORD_SYNC_1 0x5A
+#define RECORD_VERSION 3
+
+/******************************************************************************/
+/*-----------------------------Data Structures--------------------------------*/
+/******************************************************************************/
+// sent as is, so the layout is the record format (little endian, packed)
+typedef struct __attribute__((packed))
+{
+	uint16_t count;
+	uint32_t min;
+	uint32_t max;
+	uint32_t total;
+#if PROFILE_BINS > 0
+	uint16_t hist[PROFILE_BINS];
+#endif
+} stageStats;
+
+/******************************************************************************/
+/*------------------------------Global variables------------------------------*/
+/******************************************************************************/
+static stageStats stats[Stage_Count];
+static uint16_t frames;
+static volatile uint16_t overflows;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+static void resetStats();
+static void sendRecord();
+
+/******************************************************************************/
+/*-------------------------Function Implementations---------------------------*/
+/******************************************************************************/
+void profileBegin()
+{
+	Serial.begin(PROFILE_BAUD);
+	resetStats();
+
+	// Timer1 free running at the CPU clock, overflows extend it to 32 bits
+	TCCR1A = 0;
+	TCCR1B = (1 << CS10);	// no prescaler
+	TCNT1 = 0;
+	TIFR1 = (1 << TOV1);
+	TIMSK1 = (1 << TOIE1);
+}
+
+uint32_t profileNow()
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint16_t low = TCNT1;
+	uint16_t high = overflows;
+	if ((TIFR1 & (1 << TOV1)) && (low < 0x8000))
+	{
+		// wrapped since interrupts went off, the overflow is not counted yet
+		high++;
+	}
+	SREG = sreg;
+
+	return ((uint32_t)high << 16) | low;
+}
+
+void profileRecord(Stage stage, uint32_t cycles)
+{
+	stageStats *s = &stats[stage];
+
+	s->count++;
+	s->total += cycles;
+	if (cycles < s->min)
+	{
+		s->min = cycles;
+	}
+	if (cycles > s->max)
+	{
+		s->max = cycles;
+	}
+
+#if PROFILE_BINS > 0
+	// bin 0 is under 256 cycles, every bin after that is 4 times wider
+	uint8_t bin = 0;
+	cycles >>= 8;
+	while (cycles && (bin < PROFILE_BINS - 1))
+	{
+		cycles >>= 2;
+		bin++;
+	}
+	s->hist[bin]++;
+#endif
+}
+
+void profileFrame()
+{
+	if (++frames == PROFILE_FRAMES)
+	{
+		sendRecord();
+		resetStats();
+	}
+}
+
+static void resetStats()
+{
+	memset(stats, 0, sizeof(stats));
+	for (uint8_t i = 0; i < Stage_Count; i++)
+	{
+		stats[i].min = 0xFFFFFFFF;
+	}
+	frames = 0;
+}
+
+static void sendRecord()
+{
+	const uint8_t header[] = {RECORD_VERSION, Stage_Count, PROFILE_BINS, (uint8_t)frames, (uint8_t)(frames >> 8)};
+	const uint8_t *body = (const uint8_t *)stats;
+	uint8_t checksum = 0;
+
+	for (uint8_t i = 0; i < sizeof(header); i++)
+	{
+		checksum += header[i];
+	}
+	for (uint16_t i = 0; i < sizeof(stats); i++)
+	{
+		checksum += body[i];
+	}
+
+	Serial.write(RECORD_SYNC_0);
+	Serial.write(RECORD_SYNC_1);
+	Serial.write(header, sizeof(header));
+	Serial.write(body, sizeof(stats));
+	Serial.write(checksum);
+}
+
+ISR(TIMER1_OVF_vect)
+{
+	overflows++;
+}
+
+#endif // PONG_PROFILE
@@ -0,0 +1,66 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/******************************************************************************/
+/*----------------------------------Includes----------------------------------*/
+/******************************************************************************/
+#include <Arduino.h>
+
+/******************************************************************************/
+/*-----------------------------------Macros-----------------------------------*/
+/******************************************************************************/
+// Build with -DPONG_PROFILE to time the stages of a frame with Timer1 and
+// send a binary summary over Serial every PROFILE_FRAMES frames (decode it
+// with tools/profile_decode.py).  Without it the probes compile to nothing.
+#ifndef PROFILE_FRAMES
+#define PROFILE_FRAMES 64
+#endif
+
+#define PROFILE_BAUD 115200
+
+// histogram bins, each 4x wider than the last, from <256 cycles up; 0
+// leaves the histograms out and saves 2 bytes of RAM per bin and stage
+#ifndef PROFILE_BINS
+#define PROFILE_BINS 8
+#endif
+
+#ifdef PONG_PROFILE
+#define PROFILE_BEGIN(stage) uint32_t profileStart_##stage = profileNow()
+#define PROFILE_END(stage) profileRecord(stage, profileNow() - profileStart_##stage)
+#define PROFILE_FRAME() profileFrame()
+#else
+#define PROFILE_BEGIN(stage)
+#define PROFILE_END(stage)
+#define PROFILE_FRAME()
+#endif
+
+/******************************************************************************/
+/*--------------------------------Enumerations--------------------------------*/
+/******************************************************************************/
+// record order, keep tools/profile_decode.py in step
+typedef enum
+{
+	Stage_Physics,		// one whole game update, including the goal check
+	Stage_Goal,
+	Stage_Wait,			// waiting for the previous flush to finish
+	Stage_Clear,
+	Stage_Ball,
+	Stage_Paddles,
+	Stage_Score,
+	Stage_Display,
+	Stage_Count
+} Stage;
+
+/******************************************************************************/
+/*-------------------------Function Prototypes--------------------------------*/
+/******************************************************************************/
+#ifdef PONG_PROFILE
+void profileBegin();
+uint32_t profileNow();
+void profileRecord(Stage stage, uint32_t cycles);
+void profileFrame();
+#else
+inline void profileBegin() {}
+#endif
+
+#endif // PROFILE_H
@@ -0,0 +1,110 @@
+const uint8_t Lato24pt7brsBitmaps[] PROGMEM = {
+  0x48, 0xF8, 0xCF, 0x5E, 0xF2, 0x11, 0x46, 0x4F, 0x16, 0x84, 0xE6, 0xA3,
+  0xC8, 0xA3, 0xB5, 0x13, 0xA3, 0xA5, 0x23, 0xA3, 0x86, 0x34, 0x84, 0x75,
+  0x64, 0x64, 0x75, 0x7E, 0x56, 0x9C, 0x55, 0xC9, 0x65, 0xF2, 0x36, 0x6F,
+  0xB5, 0xFC, 0x5F, 0xB6, 0xFB, 0x56, 0x5F, 0x15, 0x59, 0xD5, 0x4D, 0x95,
+  0x5F, 0x07, 0x56, 0x47, 0x46, 0x56, 0x49, 0x43, 0x67, 0x3B, 0x32, 0x59,
+  0x3B, 0x31, 0x5A, 0x3B, 0x8B, 0x3B, 0x6D, 0x49, 0x31, 0x2F, 0x05, 0x55,
+  0x11, 0xF2, 0xDF, 0x6B, 0xF9, 0x70, 0xE5, 0xF8, 0xF0, 0xF0, 0xF6, 0xBF,
+  0x88, 0xFC, 0x58, 0xD8, 0x45, 0xF4, 0x53, 0x4F, 0x84, 0x23, 0xFA, 0x31,
+  0x4F, 0xA7, 0xFC, 0x6F, 0xC6, 0xFC, 0x6F, 0xC6, 0xFC, 0x7F, 0xA4, 0x13,
+  0xFA, 0x32, 0x4F, 0x84, 0x35, 0xF4, 0x54, 0x7F, 0x07, 0x5F, 0xC7, 0xFA,
+  0xAF, 0x6E, 0xF2, 0xF5, 0x90, 0x82, 0xFF, 0x04, 0xFD, 0x5F, 0x43, 0x55,
+  0xF5, 0x34, 0x5F, 0x63, 0x44, 0xF7, 0x33, 0x5F, 0x73, 0x25, 0xF8, 0x31,
+  0x5F, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0,
+  0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0xF0, 0x30, 0xFF, 0x12, 0x72,
+  0xF6, 0x35, 0x4F, 0x54, 0x45, 0xF4, 0x53, 0x6F, 0x36, 0x26, 0xF3, 0x71,
+  0x5F, 0x48, 0x14, 0xF4, 0x51, 0x7F, 0x45, 0x26, 0xF4, 0x53, 0x6F, 0x35,
+  0x46, 0xF2, 0x55, 0x6F, 0x15, 0x66, 0xF0, 0x57, 0x6D, 0x68, 0x7B, 0x69,
+  0x31, 0x49, 0x6A, 0x31, 0x56, 0x7B, 0x32, 0xF1, 0xC3, 0x3E, 0xD3, 0x4B,
+  0xF0, 0x36, 0x7F, 0x23, 0xFF, 0x03, 0xF9, 0x3C, 0x3F, 0x05, 0x85, 0xF0,
+  0x66, 0x6F, 0x07, 0x46, 0xF3, 0x62, 0x5F, 0x74, 0x24, 0xF9, 0x32, 0x3F,
+  0xA8, 0xFB, 0x6B, 0x3D, 0x6B, 0x3D, 0x6B, 0x3D, 0x6B, 0x3D, 0x6A, 0x4D,
+  0x79, 0x5B, 0x41, 0x38, 0x6A, 0x42, 0x46, 0x88, 0x52, 0xD2, 0x55, 0x54,
+  0xC2, 0xF0, 0x5A, 0x4D, 0x78, 0x6A, 0xFA, 0x70, 0xF5, 0x3F, 0xE5, 0xFC,
+  0x6F, 0xA8, 0xF9, 0x9F, 0x86, 0x13, 0xF7, 0x53, 0x3F, 0x56, 0x43, 0xF4,
+  0x65, 0x3F, 0x35, 0x73, 0xF1, 0x68, 0x3F, 0x06, 0x93, 0xE6, 0xA3, 0xD5,
+  0xC3, 0xB6, 0xD3, 0xA6, 0xE3, 0x95, 0xF1, 0x39, 0xFF, 0xFF, 0xFF, 0x9F,
+  0x63, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFE, 0x2F, 0x01,
+  0xD4, 0xA7, 0xD4, 0x4C, 0xD4, 0x1F, 0x0E, 0x31, 0xF0, 0xE9, 0x63, 0xF1,
+  0x68, 0x3F, 0x16, 0x83, 0xF1, 0x68, 0x3F, 0x16, 0x83, 0xF1, 0x68, 0x3F,
+  0x16, 0x84, 0xE7, 0x84, 0xE3, 0x13, 0x94, 0xC4, 0x13, 0x95, 0xA4, 0x23,
+  0xA6, 0x57, 0x23, 0xAF, 0x23, 0x3B, 0xF0, 0x42, 0xEB, 0xF9, 0x70, 0xF2,
+  0xAF, 0x6E, 0xF3, 0xF1, 0xF0, 0xF4, 0xD8, 0x84, 0xC7, 0xB4, 0x98, 0xD3,
+  0x85, 0x13, 0xD4, 0x65, 0x22, 0xF0, 0x34, 0x62, 0x3F, 0x03, 0x36, 0x33,
+  0xF0, 0x32, 0x64, 0x3F, 0x03, 0x16, 0x53, 0xF0, 0x87, 0x3E, 0x88, 0x4D,
+  0x31, 0x39, 0x5B, 0x41, 0x2B, 0x59, 0x51, 0x1C, 0x66, 0x6F, 0x1F, 0x1F,
+  0x3E, 0xF5, 0xCF, 0x88, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0xFD,
+  0x5F, 0xB7, 0xF9, 0x9F, 0x7B, 0xF5, 0x91, 0x3F, 0x49, 0x23, 0xF2, 0x94,
+  0x3F, 0x09, 0x63, 0xD9, 0x83, 0xB9, 0xA3, 0x99, 0xC3, 0x79, 0xE3, 0x59,
+  0xF1, 0x33, 0x9F, 0x33, 0x19, 0xF5, 0xBF, 0x79, 0xF9, 0x7F, 0xB5, 0xF6,
+  0x5E, 0x2A, 0x99, 0x86, 0xC6, 0xB3, 0xE4, 0xC2, 0xF0, 0x4D, 0x14, 0x75,
+  0x24, 0x73, 0x13, 0x94, 0x23, 0x95, 0xB3, 0x14, 0x95, 0xB7, 0xB3, 0xD6,
+  0xB3, 0xD6, 0xB3, 0xD6, 0xB3, 0xD6, 0xB3, 0xD7, 0x94, 0xD3, 0x13, 0x95,
+  0xB4, 0x14, 0x77, 0x94, 0x26, 0x35, 0x14, 0x75, 0x3C, 0x26, 0x36, 0x5B,
+  0x3E, 0x69, 0x5C, 0x94, 0x9A, 0xFA, 0x60, 0x92, 0xFD, 0x8F, 0x8C, 0xF5,
+  0xEF, 0x3F, 0x1E, 0x12, 0x47, 0x5D, 0x21, 0x49, 0x4C, 0x31, 0x3B, 0x4A,
+  0x8C, 0x38, 0x9D, 0x37, 0xAD, 0x36, 0x71, 0x3D, 0x34, 0x73, 0x3D, 0x33,
+  0x74, 0x3D, 0x23, 0x66, 0x4B, 0x31, 0x78, 0x3B, 0xA9, 0x49, 0x9B, 0x57,
+  0x9D, 0xF3, 0xF1, 0xF1, 0xF3, 0xDF, 0x79, 0xE9, 0xFA, 0xF0, 0xF5, 0xF4,
+  0xF1, 0x87, 0x8D, 0x6D, 0x6B, 0x5F, 0x25, 0x94, 0xF6, 0x47, 0x4F, 0x84,
+  0x63, 0xFA, 0x35, 0x4B, 0x77, 0x44, 0x3A, 0xA7, 0x33, 0x48, 0xD6, 0x42,
+  0x38, 0x73, 0x56, 0x32, 0x37, 0x57, 0x46, 0x31, 0x38, 0x49, 0x36, 0x77,
+  0x4A, 0x37, 0x67, 0x3B, 0x37, 0x66, 0x4B, 0x28, 0x66, 0x3B, 0x38, 0x66,
+  0x3A, 0x39, 0x66, 0x37, 0x5A, 0x66, 0x33, 0xA9, 0x75, 0xF2, 0x83, 0x13,
+  0x5B, 0x25, 0x73, 0x13, 0x57, 0x83, 0x64, 0x14, 0x52, 0xC3, 0x63, 0x33,
+  0xF4, 0x36, 0x33, 0x4F, 0x33, 0x63, 0x44, 0xF1, 0x36, 0x36, 0x4E, 0x46,
+  0x37, 0x5B, 0x46, 0x39, 0x75, 0x68, 0x2A, 0xF1, 0xF8, 0xCF, 0xE5, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD7, 0xFC, 0x8F, 0xC7, 0xFD, 0x7F, 0xD7,
+  0xFC, 0x8F, 0xC8, 0xFC, 0x7F, 0xD7, 0xFC, 0x8F, 0xC8, 0xFC, 0x7F, 0xD5,
+  0xFC, 0x6F, 0xA7, 0xF9, 0x8F, 0x88, 0xF8, 0x8F, 0x97, 0xF9, 0x7F, 0x98,
+  0xF8, 0x8F, 0x97, 0xF9, 0x7F, 0x97, 0xF9, 0x7F, 0xBF, 0xFF, 0xFF, 0xFF,
+  0xFC, 0x01, 0xFF, 0x24, 0xFE, 0x7F, 0xBA, 0xF8, 0xDF, 0x6F, 0x0F, 0x6F,
+  0x0F, 0x6F, 0x1F, 0x5F, 0x1F, 0x6F, 0x0F, 0x6F, 0x0F, 0x6D, 0xF9, 0x9F,
+  0xB7, 0xF7, 0xBF, 0x4C, 0xF4, 0xBF, 0x4C, 0xF3, 0xCF, 0x3C, 0xF3, 0xCF,
+  0x3C, 0xF4, 0xBF, 0x78, 0xFA, 0x8F, 0xAB, 0xF9, 0xCF, 0x9C, 0xF8, 0xDF,
+  0x8D, 0xF8, 0xDF, 0x8D, 0xF8, 0xDF, 0x8B, 0xFA, 0x8F, 0x99, 0xF6, 0xCF,
+  0x2F, 0x0F, 0x0E, 0xF1, 0xEF, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x2D,
+  0xF5, 0xAF, 0x86, 0xFC, 0x3F, 0xF0, 0x10, 0xF9, 0x4A, 0x3E, 0x67, 0x75,
+  0x33, 0x84, 0xA3, 0xF1, 0x3B, 0x19, 0x44, 0x25, 0x3E, 0x53, 0x23, 0x74,
+  0x34, 0x68, 0x74, 0x43, 0x76, 0x93, 0x43, 0x76, 0x93, 0x43, 0x76, 0x93,
+  0x43, 0x76, 0x93, 0x43, 0x76, 0x93, 0x43, 0x77, 0x74, 0x43, 0x73, 0x13,
+  0x73, 0x53, 0x64, 0x15, 0x35, 0x53, 0x63, 0x2C, 0x64, 0x44, 0x2B, 0x75,
+  0x24, 0x3A, 0x9A, 0x33, 0xF1, 0x94, 0x3F, 0x27, 0x53, 0xF4, 0x30, 0xFF,
+  0x93, 0xFF, 0x93, 0xFF, 0x93, 0xFF, 0x93, 0x14, 0xFF, 0x3A, 0x4F, 0xF1,
+  0x16, 0x4F, 0xF1, 0x16, 0x4F, 0xF0, 0x26, 0x4F, 0xD5, 0x40, 0x01, 0xFF,
+  0x13, 0xFE, 0x5F, 0xC7, 0xFA, 0xAF, 0x8B, 0xF9, 0xAF, 0x12, 0x6B, 0xB4,
+  0x9A, 0x76, 0xBA, 0x38, 0xDF, 0x3F, 0x2C, 0xF6, 0x9F, 0x69, 0xF5, 0x9F,
+  0x69, 0xF5, 0xAF, 0x59, 0xF5, 0xAF, 0x5A, 0xF7, 0x7F, 0xA5, 0xFC, 0x3F,
+  0xE1, 0xFF, 0x10 };
+
+const GFXglyph Lato24pt7brsGlyphs[] PROGMEM = {
+  {     0,  33,  33,  37,    2,  -32 },   // 0x25 '%'
+  {    78,  25,  33,  27,    1,  -32 },   // 0x30 '0'
+  {   125,  20,  33,  27,    5,  -32 },   // 0x31 '1'
+  {   165,  23,  33,  27,    2,  -32 },   // 0x32 '2'
+  {   222,  22,  33,  27,    3,  -32 },   // 0x33 '3'
+  {   272,  25,  33,  27,    1,  -32 },   // 0x34 '4'
+  {   321,  21,  33,  27,    3,  -32 },   // 0x35 '5'
+  {   371,  22,  33,  27,    3,  -32 },   // 0x36 '6'
+  {   424,  22,  33,  27,    3,  -32 },   // 0x37 '7'
+  {   467,  23,  33,  27,    2,  -32 },   // 0x38 '8'
+  {   523,  22,  33,  27,    3,  -32 },   // 0x39 '9'
+  {   571,  35,  37,  39,    2,  -30 },   // 0x40 '@'
+  {   671,  35,  33,  43,    4,  -32 },   // 0x4D 'M'
+  {   721,  48,  33,  48,    0,  -32 },   // 0x57 'W'
+  {   799,  22,  32,  24,    1,  -23 },   // 0x67 'g'
+  {   863,  10,  42,  12,   -1,  -33 },   // 0x6A 'j'
+  {   886,  24,  32,  24,    0,  -23 } }; // 0x79 'y'
+
+const uint8_t Lato24pt7brsIndex[] PROGMEM = {
+  0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40,
+  0x4D, 0x57, 0x67, 0x6A, 0x79 };
+
+const GFXfont Lato24pt7brs PROGMEM = {
+  (uint8_t  *)Lato24pt7brsBitmaps,
+  (GFXglyph *)Lato24pt7brsGlyphs,
+  0x25, 0x79, 56, GFXFONT_RLE,
+  (uint8_t  *)Lato24pt7brsIndex };
+
+// Approx. 1073 bytes
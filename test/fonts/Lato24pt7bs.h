@@ -0,0 +1,183 @@
+const uint8_t Lato24pt7bsBitmaps[] PROGMEM = {
+  0x0F, 0xC0, 0x00, 0x1E, 0x1F, 0xF8, 0x00, 0x1E, 0x1F, 0xFE, 0x00, 0x1E,
+  0x0F, 0x0F, 0x80, 0x1E, 0x0F, 0x03, 0xC0, 0x0F, 0x07, 0x00, 0xE0, 0x0F,
+  0x03, 0x80, 0x70, 0x0F, 0x01, 0xC0, 0x3C, 0x0F, 0x00, 0xE0, 0x1E, 0x07,
+  0x80, 0x70, 0x0F, 0x07, 0x80, 0x38, 0x07, 0x07, 0x80, 0x1E, 0x07, 0x87,
+  0x80, 0x07, 0x87, 0x87, 0x80, 0x03, 0xFF, 0xC3, 0xC0, 0x00, 0xFF, 0xC3,
+  0xC0, 0x00, 0x1F, 0x83, 0xC0, 0x00, 0x00, 0x03, 0xC1, 0xF8, 0x00, 0x01,
+  0xE3, 0xFE, 0x00, 0x01, 0xE3, 0xFF, 0x80, 0x01, 0xE1, 0xE1, 0xE0, 0x01,
+  0xE1, 0xE0, 0x70, 0x00, 0xF0, 0xE0, 0x3C, 0x00, 0xF0, 0xF0, 0x0E, 0x00,
+  0xF0, 0x78, 0x07, 0x00, 0xF0, 0x3C, 0x03, 0x80, 0x78, 0x1E, 0x01, 0xC0,
+  0x78, 0x0F, 0x00, 0xE0, 0x78, 0x03, 0x80, 0xF0, 0x78, 0x01, 0xE0, 0x70,
+  0x3C, 0x00, 0x78, 0x78, 0x3C, 0x00, 0x3F, 0xF8, 0x3C, 0x00, 0x0F, 0xF8,
+  0x3C, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xFF, 0xE0, 0x01,
+  0xFF, 0xFC, 0x01, 0xF8, 0x3F, 0x00, 0xF0, 0x07, 0xC0, 0xF0, 0x01, 0xE0,
+  0xF8, 0x00, 0xF8, 0x78, 0x00, 0x3C, 0x3C, 0x00, 0x1F, 0x3E, 0x00, 0x07,
+  0x9E, 0x00, 0x03, 0xCF, 0x00, 0x01, 0xE7, 0x80, 0x00, 0xFB, 0xC0, 0x00,
+  0x7F, 0xE0, 0x00, 0x3F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xFC, 0x00,
+  0x07, 0xFE, 0x00, 0x03, 0xEF, 0x00, 0x01, 0xF7, 0x80, 0x00, 0xFB, 0xC0,
+  0x00, 0x79, 0xE0, 0x00, 0x3C, 0xF8, 0x00, 0x1E, 0x3C, 0x00, 0x1F, 0x1E,
+  0x00, 0x0F, 0x0F, 0x80, 0x0F, 0x83, 0xC0, 0x07, 0x80, 0xF0, 0x07, 0xC0,
+  0x7E, 0x0F, 0xC0, 0x1F, 0xFF, 0xC0, 0x03, 0xFF, 0x80, 0x00, 0x7F, 0x00,
+  0x00, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x01, 0xF8, 0x00, 0x3F, 0x80, 0x0F,
+  0xF8, 0x01, 0xFF, 0x80, 0x3F, 0x78, 0x07, 0xE7, 0x80, 0xF8, 0x78, 0x0F,
+  0x07, 0x80, 0x60, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80,
+  0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78,
+  0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07,
+  0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00, 0x78, 0x00, 0x07, 0x80, 0x00,
+  0x78, 0x00, 0x07, 0x80, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0x3F, 0xFF, 0xF0,
+  0x00, 0xFF, 0x00, 0x07, 0xFF, 0x80, 0x1F, 0xFF, 0x80, 0x7C, 0x0F, 0x81,
+  0xF0, 0x0F, 0x87, 0xC0, 0x0F, 0x0F, 0x00, 0x0F, 0x3E, 0x00, 0x1E, 0x78,
+  0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00,
+  0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03,
+  0xF0, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0,
+  0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
+  0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07,
+  0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+  0xFE, 0x00, 0x1F, 0xFF, 0x00, 0xFF, 0xFE, 0x07, 0xE0, 0xFC, 0x3E, 0x00,
+  0xF8, 0xF0, 0x01, 0xE7, 0x80, 0x07, 0x9E, 0x00, 0x1E, 0x70, 0x00, 0x78,
+  0x00, 0x01, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00,
+  0x1F, 0x80, 0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7F, 0xE0, 0x00, 0x0F,
+  0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0,
+  0x00, 0x03, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x80,
+  0x07, 0xDE, 0x00, 0x3E, 0x7C, 0x01, 0xF0, 0xFC, 0x0F, 0xC1, 0xFF, 0xFE,
+  0x03, 0xFF, 0xE0, 0x01, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8,
+  0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x7B,
+  0x80, 0x00, 0x7D, 0xC0, 0x00, 0x7C, 0xE0, 0x00, 0x3C, 0x70, 0x00, 0x3C,
+  0x38, 0x00, 0x3E, 0x1C, 0x00, 0x3E, 0x0E, 0x00, 0x1E, 0x07, 0x00, 0x1E,
+  0x03, 0x80, 0x1E, 0x01, 0xC0, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0x70, 0x0F,
+  0x00, 0x38, 0x0F, 0x00, 0x1C, 0x0F, 0x80, 0x0E, 0x0F, 0x80, 0x07, 0x07,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07,
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00,
+  0x70, 0x00, 0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x83, 0xFF, 0xF8, 0x3C, 0x00,
+  0x01, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x70, 0x00, 0x03, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xF0,
+  0x3F, 0xFF, 0xE0, 0xF0, 0x3F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00,
+  0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C,
+  0x00, 0x01, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0x80, 0x00,
+  0x3C, 0x80, 0x03, 0xC7, 0x00, 0x3E, 0x7E, 0x07, 0xE3, 0xFF, 0xFE, 0x07,
+  0xFF, 0xC0, 0x07, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01,
+  0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80,
+  0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03,
+  0xC0, 0x00, 0x1E, 0x7F, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xFE, 0x1F, 0xC0,
+  0xFC, 0x7C, 0x01, 0xFB, 0xE0, 0x03, 0xEF, 0x80, 0x07, 0xFC, 0x00, 0x0F,
+  0xF0, 0x00, 0x3F, 0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0,
+  0x00, 0x3F, 0xC0, 0x01, 0xFF, 0x00, 0x07, 0x9E, 0x00, 0x3E, 0x7C, 0x01,
+  0xF0, 0xFC, 0x1F, 0x81, 0xFF, 0xFC, 0x01, 0xFF, 0xE0, 0x01, 0xFC, 0x00,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0x00,
+  0x00, 0x7C, 0x00, 0x01, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3C, 0x00, 0x01,
+  0xF0, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF0, 0x00, 0x07, 0xC0,
+  0x00, 0x1E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00,
+  0x78, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xE0,
+  0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x80, 0x00,
+  0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8,
+  0x00, 0x07, 0xC0, 0x00, 0x1E, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x07, 0xFF,
+  0x80, 0x3F, 0xFF, 0x80, 0xFC, 0x1F, 0x83, 0xE0, 0x0F, 0x87, 0x80, 0x0F,
+  0x0F, 0x00, 0x1F, 0x3E, 0x00, 0x1E, 0x7C, 0x00, 0x3C, 0x78, 0x00, 0x78,
+  0xF0, 0x01, 0xE1, 0xE0, 0x03, 0xC1, 0xE0, 0x0F, 0x83, 0xF0, 0x7E, 0x01,
+  0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0x0F, 0xFF, 0xE0, 0x3F, 0x03, 0xE0, 0xF8,
+  0x03, 0xE3, 0xE0, 0x03, 0xE7, 0x80, 0x03, 0xDF, 0x00, 0x07, 0xFE, 0x00,
+  0x07, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x7D, 0xE0, 0x00,
+  0xFB, 0xE0, 0x03, 0xE3, 0xE0, 0x0F, 0xC7, 0xF0, 0x3F, 0x07, 0xFF, 0xFC,
+  0x03, 0xFF, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x0F, 0xFF, 0x00,
+  0xFF, 0xFE, 0x07, 0xE0, 0xFC, 0x3E, 0x00, 0xF8, 0xF0, 0x01, 0xE7, 0x80,
+  0x03, 0xDE, 0x00, 0x0F, 0x78, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x80, 0x03,
+  0xDE, 0x00, 0x0F, 0x78, 0x00, 0x3D, 0xF0, 0x01, 0xF3, 0xE0, 0x0F, 0xCF,
+  0xC0, 0xFE, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xC0, 0x1F, 0x9F, 0x00, 0x00,
+  0xF8, 0x00, 0x03, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0,
+  0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00,
+  0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF8, 0x00, 0x0F, 0xC0,
+  0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
+  0xFF, 0xC0, 0x00, 0xFE, 0x01, 0xFC, 0x00, 0x3F, 0x00, 0x07, 0xC0, 0x0F,
+  0x80, 0x00, 0x3C, 0x03, 0xC0, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x00, 0x3C,
+  0x1C, 0x00, 0x00, 0x03, 0x87, 0x80, 0x0F, 0xF0, 0x78, 0xE0, 0x07, 0xFF,
+  0x07, 0x3C, 0x03, 0xFF, 0xE0, 0xE7, 0x00, 0xFC, 0x38, 0x1C, 0xE0, 0x3E,
+  0x07, 0x01, 0xFC, 0x07, 0x80, 0xE0, 0x3F, 0x01, 0xE0, 0x3C, 0x07, 0xE0,
+  0x38, 0x07, 0x00, 0xFC, 0x0F, 0x00, 0xE0, 0x1F, 0x81, 0xE0, 0x1C, 0x07,
+  0x70, 0x38, 0x07, 0x80, 0xEE, 0x07, 0x00, 0xE0, 0x1D, 0xC0, 0xE0, 0x1C,
+  0x07, 0x3C, 0x1E, 0x07, 0xC1, 0xE3, 0x83, 0xE1, 0xF8, 0x78, 0x70, 0x3F,
+  0xF7, 0xFE, 0x0F, 0x03, 0xFC, 0x7F, 0x80, 0xE0, 0x3E, 0x07, 0xC0, 0x1E,
+  0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00,
+  0x03, 0xC0, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x10, 0x03, 0xF0, 0x00,
+  0x0F, 0x00, 0x3F, 0xC0, 0x1F, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x0F,
+  0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xF8, 0x00, 0xF8, 0x00, 0x00, 0x03, 0xFF,
+  0x00, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x03,
+  0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00,
+  0x07, 0xFF, 0xBC, 0x00, 0x01, 0xEF, 0xF7, 0x80, 0x00, 0x3D, 0xFE, 0x78,
+  0x00, 0x0F, 0x3F, 0xCF, 0x80, 0x01, 0xE7, 0xF8, 0xF0, 0x00, 0x78, 0xFF,
+  0x0F, 0x00, 0x0F, 0x1F, 0xE1, 0xE0, 0x03, 0xC3, 0xFC, 0x1E, 0x00, 0xF8,
+  0x7F, 0x83, 0xC0, 0x1E, 0x0F, 0xF0, 0x3C, 0x07, 0xC1, 0xFE, 0x07, 0xC0,
+  0xF0, 0x3F, 0xC0, 0x78, 0x3C, 0x07, 0xF8, 0x0F, 0x87, 0x80, 0xFF, 0x00,
+  0xF1, 0xE0, 0x1F, 0xE0, 0x0F, 0x3C, 0x03, 0xFC, 0x01, 0xEF, 0x00, 0x7F,
+  0x80, 0x1F, 0xE0, 0x0F, 0xF0, 0x03, 0xF8, 0x01, 0xFE, 0x00, 0x3F, 0x00,
+  0x3F, 0xC0, 0x07, 0xC0, 0x07, 0xF8, 0x00, 0x70, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x1F, 0xE0, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0x80,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0xF8, 0x00, 0x03, 0xC0,
+  0x00, 0x1F, 0x7C, 0x00, 0x03, 0xC0, 0x00, 0x3E, 0x7C, 0x00, 0x07, 0xE0,
+  0x00, 0x3E, 0x7C, 0x00, 0x07, 0xE0, 0x00, 0x3C, 0x3E, 0x00, 0x07, 0xE0,
+  0x00, 0x7C, 0x3E, 0x00, 0x0F, 0xF0, 0x00, 0x7C, 0x3E, 0x00, 0x0F, 0xF0,
+  0x00, 0x78, 0x1F, 0x00, 0x0F, 0xF8, 0x00, 0xF8, 0x1F, 0x00, 0x1E, 0x78,
+  0x00, 0xF8, 0x1F, 0x00, 0x1E, 0x78, 0x00, 0xF8, 0x0F, 0x80, 0x1E, 0x7C,
+  0x00, 0xF0, 0x0F, 0x80, 0x3C, 0x3C, 0x01, 0xF0, 0x0F, 0x80, 0x3C, 0x3C,
+  0x01, 0xF0, 0x07, 0x80, 0x3C, 0x3E, 0x01, 0xE0, 0x07, 0xC0, 0x78, 0x1E,
+  0x03, 0xE0, 0x07, 0xC0, 0x78, 0x1E, 0x03, 0xE0, 0x03, 0xC0, 0x78, 0x1F,
+  0x03, 0xC0, 0x03, 0xE0, 0xF0, 0x0F, 0x07, 0xC0, 0x03, 0xE0, 0xF0, 0x0F,
+  0x07, 0xC0, 0x01, 0xE1, 0xF0, 0x0F, 0x87, 0x80, 0x01, 0xF1, 0xE0, 0x07,
+  0x87, 0x80, 0x01, 0xF1, 0xE0, 0x07, 0x8F, 0x80, 0x01, 0xF3, 0xE0, 0x07,
+  0xCF, 0x00, 0x00, 0xF3, 0xC0, 0x03, 0xCF, 0x00, 0x00, 0xFB, 0xC0, 0x03,
+  0xDF, 0x00, 0x00, 0xFB, 0xC0, 0x03, 0xFE, 0x00, 0x00, 0x7F, 0x80, 0x01,
+  0xFE, 0x00, 0x00, 0x7F, 0x80, 0x01, 0xFE, 0x00, 0x00, 0x7F, 0x00, 0x01,
+  0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x3F, 0x00, 0x00,
+  0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x78, 0x00, 0x01, 0xFC, 0x00, 0x1F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC7, 0xC1,
+  0xFF, 0x3C, 0x01, 0xE0, 0xF0, 0x07, 0x87, 0x80, 0x0E, 0x1E, 0x00, 0x38,
+  0x78, 0x00, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1E, 0x07, 0xC1, 0xF0, 0x0F,
+  0xFF, 0x80, 0x1F, 0xFC, 0x00, 0xFF, 0xC0, 0x07, 0x00, 0x00, 0x3C, 0x00,
+  0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xFF, 0xF0, 0x1F, 0xFF, 0xF0,
+  0x7F, 0xFF, 0xE3, 0xC0, 0x0F, 0x9C, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x07, 0xBE, 0x00, 0x3E, 0x7E, 0x03, 0xF0, 0xFF, 0xFF,
+  0x81, 0xFF, 0xF8, 0x00, 0xFF, 0x80, 0x07, 0x83, 0xF0, 0xFC, 0x3F, 0x0F,
+  0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x07, 0x81, 0xE0,
+  0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0x78, 0x1E, 0x07, 0x81,
+  0xE0, 0x78, 0x1E, 0x07, 0x81, 0xE0, 0xF3, 0xFC, 0xFE, 0x3E, 0x00, 0xF8,
+  0x00, 0x1F, 0x7C, 0x00, 0x1E, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0x3E,
+  0x00, 0x3C, 0x1E, 0x00, 0x78, 0x1F, 0x00, 0x78, 0x0F, 0x00, 0xF0, 0x0F,
+  0x00, 0xF0, 0x0F, 0x80, 0xF0, 0x07, 0x81, 0xE0, 0x07, 0xC1, 0xE0, 0x03,
+  0xC3, 0xC0, 0x03, 0xE3, 0xC0, 0x01, 0xE3, 0x80, 0x01, 0xE7, 0x80, 0x01,
+  0xF7, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00,
+  0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01,
+  0xE0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x00 };
+
+const GFXglyph Lato24pt7bsGlyphs[] PROGMEM = {
+  {     0,  33,  33,  37,    2,  -32 },   // 0x25 '%'
+  {   137,  25,  33,  27,    1,  -32 },   // 0x30 '0'
+  {   241,  20,  33,  27,    5,  -32 },   // 0x31 '1'
+  {   324,  23,  33,  27,    2,  -32 },   // 0x32 '2'
+  {   419,  22,  33,  27,    3,  -32 },   // 0x33 '3'
+  {   510,  25,  33,  27,    1,  -32 },   // 0x34 '4'
+  {   614,  21,  33,  27,    3,  -32 },   // 0x35 '5'
+  {   701,  22,  33,  27,    3,  -32 },   // 0x36 '6'
+  {   792,  22,  33,  27,    3,  -32 },   // 0x37 '7'
+  {   883,  23,  33,  27,    2,  -32 },   // 0x38 '8'
+  {   978,  22,  33,  27,    3,  -32 },   // 0x39 '9'
+  {  1069,  35,  37,  39,    2,  -30 },   // 0x40 '@'
+  {  1231,  35,  33,  43,    4,  -32 },   // 0x4D 'M'
+  {  1376,  48,  33,  48,    0,  -32 },   // 0x57 'W'
+  {  1574,  22,  32,  24,    1,  -23 },   // 0x67 'g'
+  {  1662,  10,  42,  12,   -1,  -33 },   // 0x6A 'j'
+  {  1715,  24,  32,  24,    0,  -23 } }; // 0x79 'y'
+
+const uint8_t Lato24pt7bsIndex[] PROGMEM = {
+  0x25, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x40,
+  0x4D, 0x57, 0x67, 0x6A, 0x79 };
+
+const GFXfont Lato24pt7bs PROGMEM = {
+  (uint8_t  *)Lato24pt7bsBitmaps,
+  (GFXglyph *)Lato24pt7bsGlyphs,
+  0x25, 0x79, 56, 0,
+  (uint8_t  *)Lato24pt7bsIndex };
+
+// Approx. 1957 bytes
@@ -0,0 +1,197 @@
+const uint8_t Lato9pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFD, 0x00, 0xC0, 0xDE, 0xF6, 0x90, 0x09, 0x82, 0x61, 0x90,
+  0x64, 0x7F, 0xC4, 0xC1, 0x30, 0x48, 0xFF, 0x88, 0x82, 0x60, 0x98, 0x64,
+  0x00, 0x0C, 0x1F, 0x1E, 0xC9, 0x04, 0x82, 0x41, 0xE0, 0x3C, 0x0B, 0x04,
+  0xC2, 0x71, 0x2E, 0xF1, 0xF0, 0x40, 0x20, 0x70, 0x38, 0x86, 0x88, 0xC8,
+  0x88, 0x89, 0x08, 0xB0, 0x76, 0x00, 0x4E, 0x09, 0x11, 0x91, 0x31, 0x12,
+  0x11, 0xC0, 0xE0, 0x1E, 0x03, 0x30, 0x21, 0x06, 0x00, 0x20, 0x03, 0x00,
+  0x38, 0x07, 0xC4, 0xC6, 0x48, 0x3C, 0x81, 0x8C, 0x3C, 0x3C, 0x70, 0xFD,
+  0x23, 0x66, 0x4C, 0xCC, 0xCC, 0xCC, 0x46, 0x63, 0x20, 0x93, 0x26, 0xC9,
+  0x24, 0xB6, 0xB4, 0x80, 0x25, 0x5C, 0xEA, 0x90, 0x08, 0x04, 0x02, 0x01,
+  0x0F, 0xF8, 0x40, 0x20, 0x10, 0x08, 0x00, 0xD8, 0xF0, 0xC0, 0x06, 0x08,
+  0x30, 0x40, 0x83, 0x04, 0x18, 0x20, 0x41, 0x02, 0x0C, 0x10, 0x00, 0x3C,
+  0x31, 0x30, 0xD8, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xE0, 0xF0, 0xCC,
+  0x43, 0xC0, 0x18, 0x38, 0x78, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x7F, 0x3E, 0x31, 0xB0, 0x58, 0x20, 0x30, 0x18, 0x18, 0x1C,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x0F, 0xF8, 0x3E, 0x31, 0x90, 0x58, 0x20, 0x10,
+  0x18, 0x38, 0x06, 0x01, 0x80, 0xF0, 0x4C, 0x63, 0xE0, 0x03, 0x00, 0xC0,
+  0x70, 0x34, 0x19, 0x04, 0x43, 0x11, 0x84, 0x41, 0x3F, 0xF0, 0x10, 0x04,
+  0x01, 0x00, 0x3F, 0x60, 0x60, 0x40, 0x40, 0x7C, 0x03, 0x03, 0x01, 0x01,
+  0x03, 0xC6, 0x7C, 0x06, 0x06, 0x06, 0x06, 0x02, 0x03, 0xF3, 0x8D, 0x82,
+  0xC1, 0xE0, 0xF0, 0x4C, 0x63, 0xC0, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0x60,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x00, 0x3C, 0x31, 0x30,
+  0xD8, 0x2C, 0x33, 0x10, 0xF0, 0x86, 0xC1, 0x60, 0xF0, 0x48, 0x63, 0xE0,
+  0x1E, 0x31, 0x90, 0x58, 0x3C, 0x1A, 0x0D, 0x8C, 0x7E, 0x06, 0x02, 0x03,
+  0x03, 0x03, 0x00, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xDC, 0x02, 0x0C, 0x73,
+  0x8E, 0x07, 0x03, 0x81, 0xFF, 0x00, 0x00, 0xFF, 0x81, 0xC0, 0xE0, 0x70,
+  0xE7, 0x38, 0x40, 0x79, 0x88, 0x18, 0x30, 0x61, 0x86, 0x08, 0x10, 0x00,
+  0x00, 0x03, 0x00, 0x0F, 0x81, 0x83, 0x18, 0x04, 0x80, 0x38, 0x7C, 0xC6,
+  0x46, 0x22, 0x33, 0x11, 0x99, 0x94, 0x77, 0x10, 0x00, 0xC0, 0x03, 0x03,
+  0x07, 0xE0, 0x06, 0x00, 0x70, 0x0F, 0x00, 0xD0, 0x19, 0x81, 0x88, 0x10,
+  0xC3, 0x0C, 0x3F, 0xC6, 0x06, 0x60, 0x24, 0x03, 0xC0, 0x30, 0xFC, 0x41,
+  0xA0, 0xD0, 0x68, 0x34, 0x13, 0xF1, 0x06, 0x81, 0xC0, 0xE0, 0x50, 0x6F,
+  0xE0, 0x0F, 0x86, 0x1D, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x01, 0x80, 0x18, 0x71, 0xF8, 0xFE, 0x10, 0x32, 0x03, 0x40,
+  0x68, 0x05, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x1A, 0x03, 0x40, 0xCF,
+  0xE0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0xFF, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x0F, 0xC6, 0x0D, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x30,
+  0x06, 0x0F, 0xC0, 0x38, 0x05, 0x80, 0x98, 0x30, 0xFC, 0x80, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0xE0, 0x3F, 0xFE, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03,
+  0x80, 0xC0, 0xFF, 0xFF, 0xFF, 0xC0, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08,
+  0x46, 0x3E, 0x00, 0x81, 0xE0, 0xC8, 0x32, 0x18, 0x8C, 0x26, 0x0F, 0x02,
+  0x60, 0x8C, 0x21, 0x88, 0x32, 0x06, 0x80, 0xC0, 0x81, 0x02, 0x04, 0x08,
+  0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, 0xC0, 0x1E, 0x01, 0xF8,
+  0x0F, 0x40, 0xFB, 0x05, 0xC8, 0x6E, 0x62, 0x71, 0x33, 0x8D, 0x1C, 0x38,
+  0xE1, 0x87, 0x00, 0x38, 0x01, 0x80, 0x80, 0xF0, 0x3E, 0x0F, 0xC3, 0xB0,
+  0xE6, 0x38, 0xCE, 0x1B, 0x86, 0xE0, 0xD8, 0x1E, 0x03, 0x80, 0xC0, 0x0F,
+  0x81, 0x86, 0x18, 0x09, 0x80, 0x6C, 0x01, 0x60, 0x0B, 0x00, 0x78, 0x02,
+  0xC0, 0x16, 0x01, 0x98, 0x08, 0x61, 0x80, 0xF8, 0x00, 0xFC, 0x83, 0x83,
+  0x81, 0x81, 0x83, 0x86, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x0F, 0x81,
+  0x86, 0x18, 0x09, 0x80, 0x6C, 0x01, 0x60, 0x0B, 0x00, 0x78, 0x03, 0xC0,
+  0x16, 0x01, 0x98, 0x0C, 0x61, 0xC0, 0xFC, 0x00, 0x30, 0x00, 0xC0, 0x03,
+  0xFC, 0x43, 0x20, 0xD0, 0x68, 0x34, 0x1A, 0x19, 0xF8, 0x8C, 0x42, 0x21,
+  0x90, 0x68, 0x18, 0x3F, 0x42, 0xC0, 0xC0, 0xE0, 0x78, 0x3E, 0x0F, 0x03,
+  0x03, 0x03, 0xC6, 0x7C, 0xFF, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+  0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00, 0xC0, 0x78, 0x0F,
+  0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x09, 0x83,
+  0x18, 0xC1, 0xF0, 0xC0, 0x34, 0x03, 0x60, 0x66, 0x06, 0x30, 0x43, 0x0C,
+  0x10, 0xC1, 0x98, 0x09, 0x80, 0xD0, 0x0F, 0x00, 0x70, 0x06, 0x00, 0xC0,
+  0xC0, 0xD0, 0x30, 0x36, 0x0E, 0x09, 0x87, 0x86, 0x21, 0xA1, 0x8C, 0x4C,
+  0x63, 0x33, 0x30, 0xCC, 0x4C, 0x1A, 0x1B, 0x07, 0x86, 0x81, 0xE0, 0xE0,
+  0x30, 0x38, 0x0C, 0x0C, 0x00, 0xE0, 0x6C, 0x18, 0xC3, 0x0C, 0xC1, 0xB0,
+  0x1E, 0x03, 0x80, 0x78, 0x19, 0x06, 0x30, 0xC3, 0x30, 0x6C, 0x06, 0xC0,
+  0x6C, 0x08, 0x83, 0x18, 0xC1, 0x98, 0x36, 0x03, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x18, 0x03, 0x00, 0x60, 0xFF, 0xC0, 0x60, 0x38, 0x0C, 0x06, 0x03,
+  0x00, 0xC0, 0x60, 0x30, 0x1C, 0x06, 0x03, 0x00, 0xFF, 0x80, 0xFC, 0xCC,
+  0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, 0x81, 0x81, 0x03, 0x02, 0x04, 0x04,
+  0x08, 0x18, 0x10, 0x30, 0x20, 0x40, 0x40, 0xE4, 0x92, 0x49, 0x24, 0x92,
+  0x4F, 0x18, 0x1C, 0x34, 0x26, 0x62, 0xC1, 0xFE, 0xE2, 0x10, 0x7D, 0x8C,
+  0x18, 0x33, 0xF8, 0xE1, 0xE3, 0x7A, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xE3,
+  0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xE3, 0xDC, 0x3C, 0x87, 0x04, 0x08, 0x10,
+  0x30, 0x21, 0x3C, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x47, 0xC3, 0x83, 0x83,
+  0x83, 0xC3, 0xC7, 0x7B, 0x3C, 0x42, 0x83, 0xFF, 0x80, 0x80, 0xC0, 0x63,
+  0x3E, 0x1C, 0xC2, 0x08, 0xFC, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x3F,
+  0xB1, 0x90, 0xCC, 0x63, 0xE3, 0x01, 0x80, 0x7E, 0x41, 0xE0, 0xD0, 0xC7,
+  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  0xC3, 0xC3, 0xC0, 0xFF, 0xFF, 0xC0, 0x30, 0x00, 0x33, 0x33, 0x33, 0x33,
+  0x33, 0x3E, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0xC6, 0xCC, 0xD8, 0xF0, 0xD8,
+  0xCC, 0xC6, 0xC3, 0xFF, 0xFF, 0xFF, 0xC0, 0xDC, 0xE7, 0x38, 0xB0, 0x87,
+  0x84, 0x3C, 0x21, 0xE1, 0x0F, 0x08, 0x78, 0x43, 0xC2, 0x18, 0xDE, 0xE3,
+  0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x42, 0xC3, 0x81, 0x81,
+  0x81, 0xC3, 0x42, 0x3C, 0xDE, 0xE3, 0xC3, 0xC1, 0xC1, 0xC1, 0xC3, 0xC2,
+  0xFC, 0xC0, 0xC0, 0xC0, 0x3F, 0x47, 0xC3, 0x83, 0x83, 0x83, 0xC3, 0xC7,
+  0x7B, 0x03, 0x03, 0x03, 0xDF, 0x8C, 0x30, 0xC3, 0x0C, 0x30, 0xC0, 0x7B,
+  0x18, 0x38, 0x78, 0x30, 0x63, 0xF8, 0x20, 0x82, 0x3F, 0x20, 0x82, 0x08,
+  0x20, 0x83, 0x07, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7B,
+  0xC1, 0xA0, 0x98, 0xC4, 0x63, 0x21, 0xB0, 0x50, 0x38, 0x0C, 0x00, 0xC3,
+  0x0D, 0x0C, 0x26, 0x71, 0x99, 0x66, 0x24, 0x90, 0xB2, 0xC3, 0x8F, 0x06,
+  0x18, 0x18, 0x60, 0xE1, 0xB1, 0x8D, 0x82, 0x81, 0xC0, 0xA0, 0xD8, 0xC6,
+  0xC1, 0x80, 0xC1, 0xB0, 0x98, 0xC4, 0x63, 0x20, 0xB0, 0x70, 0x38, 0x08,
+  0x0C, 0x04, 0x06, 0x00, 0xFE, 0x18, 0x30, 0xC3, 0x04, 0x18, 0x60, 0xFE,
+  0x3B, 0x18, 0xC6, 0x10, 0x8C, 0xC3, 0x08, 0xC6, 0x31, 0x87, 0xFF, 0xFF,
+  0xC6, 0x22, 0x26, 0x62, 0x12, 0x62, 0x22, 0x2C, 0x01, 0x71, 0xCF, 0x80 };
+
+const GFXglyph Lato9pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     5,   5,   4,   7,    1,  -12 },   // 0x22 '"'
+  {     8,  10,  13,  10,    0,  -12 },   // 0x23 '#'
+  {    25,   9,  16,  10,    1,  -13 },   // 0x24 '$'
+  {    43,  12,  13,  14,    1,  -12 },   // 0x25 '%'
+  {    63,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {    83,   2,   4,   4,    1,  -12 },   // 0x27 '''
+  {    84,   4,  17,   5,    1,  -13 },   // 0x28 '('
+  {    93,   3,  17,   5,    1,  -13 },   // 0x29 ')'
+  {   100,   5,   6,   7,    1,  -12 },   // 0x2A '*'
+  {   104,   9,   9,  10,    1,  -10 },   // 0x2B '+'
+  {   115,   2,   3,   4,    1,    0 },   // 0x2C ','
+  {   116,   4,   1,   6,    1,   -5 },   // 0x2D '-'
+  {   117,   2,   1,   4,    1,    0 },   // 0x2E '.'
+  {   118,   7,  14,   7,    0,  -12 },   // 0x2F '/'
+  {   131,   9,  13,  10,    1,  -12 },   // 0x30 '0'
+  {   146,   8,  13,  10,    2,  -12 },   // 0x31 '1'
+  {   159,   9,  13,  10,    1,  -12 },   // 0x32 '2'
+  {   174,   9,  13,  10,    1,  -12 },   // 0x33 '3'
+  {   189,  10,  13,  10,    0,  -12 },   // 0x34 '4'
+  {   206,   8,  13,  10,    1,  -12 },   // 0x35 '5'
+  {   219,   9,  13,  10,    1,  -12 },   // 0x36 '6'
+  {   234,   9,  13,  10,    1,  -12 },   // 0x37 '7'
+  {   249,   9,  13,  10,    1,  -12 },   // 0x38 '8'
+  {   264,   9,  13,  10,    1,  -12 },   // 0x39 '9'
+  {   279,   2,   9,   5,    1,   -8 },   // 0x3A ':'
+  {   282,   2,  11,   5,    1,   -8 },   // 0x3B ';'
+  {   285,   7,   8,  10,    1,   -9 },   // 0x3C '<'
+  {   292,   8,   4,  10,    1,   -7 },   // 0x3D '='
+  {   296,   7,   8,  10,    2,   -9 },   // 0x3E '>'
+  {   303,   7,  13,   7,    0,  -12 },   // 0x3F '?'
+  {   315,  13,  14,  15,    1,  -11 },   // 0x40 '@'
+  {   338,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   358,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {   373,  11,  13,  12,    1,  -12 },   // 0x43 'C'
+  {   391,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   409,   8,  13,  10,    2,  -12 },   // 0x45 'E'
+  {   422,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {   435,  11,  13,  13,    1,  -12 },   // 0x47 'G'
+  {   453,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   470,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   474,   5,  13,   8,    1,  -12 },   // 0x4A 'J'
+  {   483,  10,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {   500,   7,  13,   9,    2,  -12 },   // 0x4C 'L'
+  {   512,  13,  13,  17,    2,  -12 },   // 0x4D 'M'
+  {   534,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   551,  13,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   573,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   586,  13,  16,  14,    1,  -12 },   // 0x51 'Q'
+  {   612,   9,  13,  12,    2,  -12 },   // 0x52 'R'
+  {   627,   8,  13,  10,    1,  -12 },   // 0x53 'S'
+  {   640,  10,  13,  11,    0,  -12 },   // 0x54 'T'
+  {   657,  11,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   675,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {   695,  18,  13,  18,    0,  -12 },   // 0x57 'W'
+  {   725,  11,  13,  12,    0,  -12 },   // 0x58 'X'
+  {   743,  11,  13,  11,    0,  -12 },   // 0x59 'Y'
+  {   761,  10,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   778,   4,  16,   5,    1,  -12 },   // 0x5B '['
+  {   786,   7,  14,   7,    0,  -12 },   // 0x5C '\'
+  {   799,   3,  16,   5,    1,  -12 },   // 0x5D ']'
+  {   805,   8,   6,  10,    1,  -12 },   // 0x5E '^'
+  {   811,   7,   1,   7,    0,    2 },   // 0x5F '_'
+  {   812,   4,   3,   6,    0,  -12 },   // 0x60 '`'
+  {   814,   7,   9,   9,    1,   -8 },   // 0x61 'a'
+  {   822,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {   835,   7,   9,   8,    1,   -8 },   // 0x63 'c'
+  {   843,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {   856,   8,   9,   9,    1,   -8 },   // 0x65 'e'
+  {   865,   6,  13,   6,    0,  -12 },   // 0x66 'f'
+  {   875,   9,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   889,   8,  13,  10,    1,  -12 },   // 0x68 'h'
+  {   902,   2,  13,   5,    1,  -12 },   // 0x69 'i'
+  {   906,   4,  16,   5,   -1,  -12 },   // 0x6A 'j'
+  {   914,   8,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {   927,   2,  13,   5,    1,  -12 },   // 0x6C 'l'
+  {   931,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
+  {   946,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   955,   8,   9,  10,    1,   -8 },   // 0x6F 'o'
+  {   964,   8,  12,  10,    1,   -8 },   // 0x70 'p'
+  {   976,   8,  12,  10,    1,   -8 },   // 0x71 'q'
+  {   988,   6,   9,   7,    1,   -8 },   // 0x72 'r'
+  {   995,   6,   9,   8,    1,   -8 },   // 0x73 's'
+  {  1002,   6,  12,   7,    0,  -11 },   // 0x74 't'
+  {  1011,   8,   9,  10,    1,   -8 },   // 0x75 'u'
+  {  1020,   9,   9,   9,    0,   -8 },   // 0x76 'v'
+  {  1031,  14,   9,  14,    0,   -8 },   // 0x77 'w'
+  {  1047,   9,   9,   9,    0,   -8 },   // 0x78 'x'
+  {  1058,   9,  12,   9,    0,   -8 },   // 0x79 'y'
+  {  1072,   7,   9,   8,    1,   -8 },   // 0x7A 'z'
+  {  1080,   5,  16,   5,    0,  -12 },   // 0x7B '{'
+  {  1090,   1,  16,   5,    2,  -12 },   // 0x7C '|'
+  {  1092,   4,  16,   5,    1,  -12 },   // 0x7D '}'
+  {  1100,   8,   4,  10,    1,   -6 } }; // 0x7E '~'
+
+const GFXfont Lato9pt7b PROGMEM = {
+  (uint8_t  *)Lato9pt7bBitmaps,
+  (GFXglyph *)Lato9pt7bGlyphs,
+  0x20, 0x7E, 21 };
+
+// Approx. 1779 bytes
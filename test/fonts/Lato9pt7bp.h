@@ -0,0 +1,222 @@
+const uint8_t Lato9pt7bpBitmaps[] PROGMEM = {
+  0x00, 0x7F, 0xFF, 0x10, 0x10, 0x07, 0x0F, 0x00, 0x07, 0x0F, 0x00, 0x10,
+  0x10, 0xFC, 0x1F, 0x10, 0xF0, 0x7F, 0x13, 0x10, 0x01, 0x11, 0x1F, 0x01,
+  0x01, 0x1D, 0x0F, 0x01, 0x01, 0x00, 0x00, 0x7C, 0x46, 0xC6, 0xFF, 0x83,
+  0x86, 0x04, 0x00, 0x18, 0x10, 0x30, 0xE0, 0x3F, 0x30, 0x31, 0x1F, 0x06,
+  0x3E, 0x41, 0x41, 0x41, 0x3E, 0xC0, 0x60, 0x30, 0x8C, 0x86, 0x83, 0x01,
+  0x10, 0x10, 0x0C, 0x06, 0x03, 0x00, 0x00, 0x0F, 0x10, 0x10, 0x10, 0x0F,
+  0x00, 0x88, 0xFE, 0xE3, 0xC1, 0x81, 0x03, 0x06, 0x00, 0x80, 0x00, 0x00,
+  0x0F, 0x09, 0x10, 0x10, 0x10, 0x11, 0x0B, 0x0E, 0x0E, 0x1B, 0x10, 0x10,
+  0x07, 0x0F, 0xE0, 0xFC, 0x0F, 0x02, 0x0F, 0x7F, 0xE0, 0x80, 0x00, 0x00,
+  0x01, 0x00, 0x07, 0x3C, 0xF0, 0xC0, 0x78, 0x1F, 0x01, 0x00, 0x00, 0x12,
+  0x0C, 0x3F, 0x0C, 0x12, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x10, 0x10, 0x10,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x05, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x80, 0xE0, 0x3C, 0x07,
+  0x01, 0x30, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0E, 0x03, 0x01,
+  0x01, 0x01, 0x06, 0xFC, 0xF8, 0x07, 0x0E, 0x18, 0x10, 0x10, 0x10, 0x0C,
+  0x07, 0x03, 0x08, 0x0C, 0x06, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x10,
+  0x10, 0x1F, 0x1F, 0x10, 0x10, 0x10, 0x0C, 0x0E, 0x03, 0x01, 0x81, 0xC1,
+  0xF3, 0x3E, 0x00, 0x18, 0x1C, 0x1E, 0x17, 0x13, 0x11, 0x10, 0x10, 0x10,
+  0x08, 0x0E, 0x03, 0x01, 0x41, 0x41, 0xE3, 0xBE, 0x00, 0x04, 0x0C, 0x18,
+  0x10, 0x10, 0x10, 0x18, 0x0F, 0x03, 0x00, 0x80, 0xC0, 0x70, 0x18, 0x0C,
+  0x07, 0xFF, 0x00, 0x00, 0x02, 0x03, 0x02, 0x02, 0x02, 0x02, 0x02, 0x1F,
+  0x02, 0x02, 0x00, 0x3E, 0x27, 0x21, 0x21, 0x21, 0xC1, 0xC1, 0x08, 0x18,
+  0x10, 0x10, 0x10, 0x18, 0x0C, 0x07, 0xC0, 0xE0, 0x78, 0x2C, 0x26, 0x23,
+  0x61, 0xC0, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x10, 0x08, 0x0F, 0x03,
+  0x01, 0x01, 0x01, 0x01, 0xC1, 0xF1, 0x3D, 0x0F, 0x03, 0x00, 0x10, 0x1C,
+  0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xBE, 0x63, 0x41, 0x41, 0x41,
+  0xB6, 0x9C, 0x00, 0x07, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x02,
+  0x18, 0x7E, 0xC2, 0x81, 0x81, 0x81, 0xC3, 0xFE, 0x38, 0x00, 0x00, 0x10,
+  0x18, 0x0C, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x05, 0x07, 0x10, 0x18, 0x38, 0x2C, 0x64, 0x46, 0xC3, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0xC3, 0x42, 0x66, 0x24, 0x3C, 0x18, 0x18,
+  0x02, 0x03, 0x01, 0xC1, 0x61, 0x3E, 0x1C, 0x00, 0x00, 0x10, 0x11, 0x00,
+  0x00, 0x00, 0xF0, 0x0C, 0x06, 0x82, 0xE1, 0x31, 0x11, 0x11, 0xF1, 0x12,
+  0x02, 0x0C, 0xF8, 0x03, 0x0C, 0x18, 0x11, 0x23, 0x22, 0x22, 0x21, 0x23,
+  0x22, 0x12, 0x11, 0x00, 0x00, 0x00, 0x80, 0xF0, 0x3C, 0x0F, 0x07, 0x1E,
+  0xF0, 0xC0, 0x00, 0x00, 0x10, 0x1E, 0x07, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x03, 0x1E, 0x18, 0xFF, 0x41, 0x41, 0x41, 0x41, 0x41, 0xBE, 0x9E,
+  0x00, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x03, 0xF8, 0xFC,
+  0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x02, 0x03, 0x07, 0x0C,
+  0x18, 0x10, 0x10, 0x10, 0x10, 0x18, 0x08, 0x08, 0xFF, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x02, 0x0E, 0xFC, 0xE0, 0x1F, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x08, 0x0E, 0x07, 0x01, 0xFF, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x01, 0x01, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x41,
+  0x41, 0x41, 0x41, 0x41, 0x41, 0x01, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xF8, 0xFC, 0x06, 0x02, 0x01, 0x01, 0x01, 0x81, 0x81, 0x83,
+  0x82, 0x03, 0x07, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x18, 0x0F,
+  0xFF, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xFF, 0xFF, 0x1F, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0xFF, 0x1F, 0x1F,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x10, 0x10, 0x0C, 0x0F, 0xFF, 0x40,
+  0x40, 0xE0, 0xB0, 0x18, 0x0E, 0x07, 0x01, 0x01, 0x1F, 0x00, 0x00, 0x00,
+  0x01, 0x03, 0x06, 0x0C, 0x18, 0x10, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0xFF, 0x07, 0x1C, 0x70,
+  0xC0, 0x00, 0x00, 0x80, 0xE0, 0x38, 0x0E, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
+  0x00, 0x01, 0x07, 0x06, 0x03, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xFF, 0x0E,
+  0x1C, 0x38, 0x60, 0xC0, 0x80, 0x00, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x03, 0x06, 0x1D, 0x1F, 0xF8, 0xFC, 0x06, 0x02, 0x01, 0x01,
+  0x01, 0x01, 0x03, 0x02, 0x0C, 0xF8, 0x40, 0x03, 0x07, 0x0C, 0x08, 0x10,
+  0x10, 0x10, 0x10, 0x18, 0x08, 0x06, 0x03, 0x00, 0xFF, 0x81, 0x81, 0x81,
+  0x81, 0xC1, 0x66, 0x3E, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xF8, 0xFC, 0x06, 0x02, 0x01, 0x01, 0x01, 0x01, 0x03, 0x02, 0x0C, 0xF8,
+  0xC0, 0x03, 0x07, 0x0C, 0x08, 0x10, 0x10, 0x10, 0x10, 0x18, 0x38, 0x6E,
+  0xC7, 0x80, 0xFF, 0x81, 0x81, 0x81, 0x81, 0xC3, 0x7E, 0x3C, 0x00, 0x1F,
+  0x00, 0x00, 0x00, 0x01, 0x07, 0x0C, 0x18, 0x10, 0x1C, 0x3E, 0x71, 0x61,
+  0xE1, 0xC1, 0xC3, 0x81, 0x08, 0x18, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07,
+  0x01, 0x01, 0x01, 0x01, 0xFF, 0xFF, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x07, 0x0C, 0x18, 0x10,
+  0x10, 0x10, 0x18, 0x0C, 0x07, 0x01, 0x01, 0x0F, 0x3C, 0xF0, 0x80, 0x00,
+  0x00, 0x80, 0xE0, 0x7C, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1E,
+  0x1C, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0F, 0xFC, 0xE0, 0x00, 0x00,
+  0xC0, 0xF8, 0x1F, 0x0F, 0x7C, 0xE0, 0x00, 0x00, 0xC0, 0xF8, 0x3F, 0x03,
+  0x00, 0x00, 0x00, 0x07, 0x1F, 0x1E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x1F, 0x1C, 0x0F, 0x01, 0x00, 0x00, 0x01, 0x03, 0x07, 0x1C, 0xF8, 0xE0,
+  0xF0, 0xB8, 0x0E, 0x07, 0x01, 0x10, 0x18, 0x0E, 0x07, 0x01, 0x00, 0x00,
+  0x03, 0x0E, 0x1C, 0x10, 0x01, 0x03, 0x0E, 0x38, 0x70, 0xC0, 0xE0, 0x38,
+  0x1C, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x81, 0xE1, 0x71, 0x1D, 0x0F, 0x07, 0x01,
+  0x18, 0x1E, 0x17, 0x13, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0xFF, 0xFF,
+  0x01, 0x01, 0xFF, 0xFF, 0x80, 0x80, 0x03, 0x0E, 0x38, 0xC0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1C, 0x20, 0x01, 0x01, 0xFF, 0x80,
+  0x80, 0xFF, 0x20, 0x30, 0x1C, 0x07, 0x03, 0x0E, 0x18, 0x20, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x03, 0x04, 0xE2, 0xA3, 0x11,
+  0x11, 0x11, 0xFF, 0xFE, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0xFF,
+  0xFF, 0x20, 0x10, 0x10, 0x10, 0x70, 0xE0, 0x1F, 0x1F, 0x08, 0x10, 0x10,
+  0x10, 0x0C, 0x0F, 0x7C, 0xC6, 0x01, 0x01, 0x01, 0x01, 0x82, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0xC0, 0x60, 0x10, 0x10, 0x10, 0x30, 0xFF,
+  0xFF, 0x0F, 0x1C, 0x10, 0x10, 0x10, 0x08, 0x1F, 0x1F, 0x7C, 0xCA, 0x89,
+  0x09, 0x09, 0x09, 0x8E, 0x8C, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x10, 0x10, 0xFE, 0x13, 0x11, 0x11, 0x00, 0x00, 0x1F, 0x00, 0x00,
+  0x00, 0x00, 0x6E, 0xFB, 0x91, 0x91, 0x91, 0x9F, 0x8F, 0x01, 0x02, 0x07,
+  0x08, 0x08, 0x08, 0x08, 0x0C, 0x07, 0x03, 0xFF, 0xFF, 0x20, 0x10, 0x10,
+  0x10, 0xF0, 0xE0, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0xF1,
+  0xF1, 0x1F, 0x1F, 0x00, 0x00, 0xF1, 0xF1, 0x80, 0x80, 0xFF, 0x7F, 0xFF,
+  0xFF, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x10, 0x1F, 0x1F, 0x01, 0x03, 0x06,
+  0x0C, 0x18, 0x10, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xFF, 0x02, 0x01, 0x01,
+  0x03, 0xFE, 0x02, 0x01, 0x01, 0x01, 0xFE, 0xFC, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0xFF, 0xFF, 0x02,
+  0x01, 0x01, 0x01, 0xFF, 0xFE, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x01, 0x7C, 0xC6, 0x01, 0x01, 0x01, 0x01, 0xC6, 0x7C, 0x00, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0x02, 0x01, 0x01, 0x01, 0xC7,
+  0x7E, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0xFC, 0xC6, 0x01,
+  0x01, 0x01, 0x83, 0xFF, 0xFF, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x0F,
+  0x0F, 0xFF, 0xFF, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x8E, 0x1B, 0x19, 0x11, 0xB1, 0xE2, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08, 0x00, 0x00, 0x07, 0x0C, 0x08,
+  0x08, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x07, 0x3C, 0xF0, 0x80, 0xE0, 0x3C,
+  0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x0F, 0x7C, 0xC0, 0xE0, 0x3C, 0x07, 0x0F, 0x78, 0xC0, 0xE0, 0x7C, 0x0F,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x83, 0xC7, 0x7C, 0x10, 0x7C, 0xC6, 0x83, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x07, 0x1E,
+  0xF0, 0xC0, 0xE0, 0x3C, 0x0F, 0x01, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x81, 0xC1, 0x71, 0x19, 0x0F, 0x07, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x9E, 0xFF, 0x01, 0x01, 0x01, 0x7B,
+  0xFE, 0x80, 0x80, 0xFF, 0xFF, 0x01, 0x63, 0xFE, 0x00, 0x80, 0x84, 0x7E,
+  0x01, 0x0C, 0x06, 0x02, 0x02, 0x04, 0x04, 0x04, 0x07 };
+
+const GFXglyph Lato9pt7bpGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     5,   5,   4,   7,    1,  -12 },   // 0x22 '"'
+  {    10,  10,  13,  10,    0,  -12 },   // 0x23 '#'
+  {    30,   9,  16,  10,    1,  -13 },   // 0x24 '$'
+  {    48,  12,  13,  14,    1,  -12 },   // 0x25 '%'
+  {    72,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {    96,   2,   4,   4,    1,  -12 },   // 0x27 '''
+  {    98,   4,  17,   5,    1,  -13 },   // 0x28 '('
+  {   110,   3,  17,   5,    1,  -13 },   // 0x29 ')'
+  {   119,   5,   6,   7,    1,  -12 },   // 0x2A '*'
+  {   124,   9,   9,  10,    1,  -10 },   // 0x2B '+'
+  {   142,   2,   3,   4,    1,    0 },   // 0x2C ','
+  {   144,   4,   1,   6,    1,   -5 },   // 0x2D '-'
+  {   148,   2,   1,   4,    1,    0 },   // 0x2E '.'
+  {   150,   7,  14,   7,    0,  -12 },   // 0x2F '/'
+  {   164,   9,  13,  10,    1,  -12 },   // 0x30 '0'
+  {   182,   8,  13,  10,    2,  -12 },   // 0x31 '1'
+  {   198,   9,  13,  10,    1,  -12 },   // 0x32 '2'
+  {   216,   9,  13,  10,    1,  -12 },   // 0x33 '3'
+  {   234,  10,  13,  10,    0,  -12 },   // 0x34 '4'
+  {   254,   8,  13,  10,    1,  -12 },   // 0x35 '5'
+  {   270,   9,  13,  10,    1,  -12 },   // 0x36 '6'
+  {   288,   9,  13,  10,    1,  -12 },   // 0x37 '7'
+  {   306,   9,  13,  10,    1,  -12 },   // 0x38 '8'
+  {   324,   9,  13,  10,    1,  -12 },   // 0x39 '9'
+  {   342,   2,   9,   5,    1,   -8 },   // 0x3A ':'
+  {   346,   2,  11,   5,    1,   -8 },   // 0x3B ';'
+  {   350,   7,   8,  10,    1,   -9 },   // 0x3C '<'
+  {   357,   8,   4,  10,    1,   -7 },   // 0x3D '='
+  {   365,   7,   8,  10,    2,   -9 },   // 0x3E '>'
+  {   372,   7,  13,   7,    0,  -12 },   // 0x3F '?'
+  {   386,  13,  14,  15,    1,  -11 },   // 0x40 '@'
+  {   412,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   436,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {   454,  11,  13,  12,    1,  -12 },   // 0x43 'C'
+  {   476,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   498,   8,  13,  10,    2,  -12 },   // 0x45 'E'
+  {   514,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {   530,  11,  13,  13,    1,  -12 },   // 0x47 'G'
+  {   552,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   572,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   576,   5,  13,   8,    1,  -12 },   // 0x4A 'J'
+  {   586,  10,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {   606,   7,  13,   9,    2,  -12 },   // 0x4C 'L'
+  {   620,  13,  13,  17,    2,  -12 },   // 0x4D 'M'
+  {   646,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   666,  13,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   692,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   708,  13,  16,  14,    1,  -12 },   // 0x51 'Q'
+  {   734,   9,  13,  12,    2,  -12 },   // 0x52 'R'
+  {   752,   8,  13,  10,    1,  -12 },   // 0x53 'S'
+  {   768,  10,  13,  11,    0,  -12 },   // 0x54 'T'
+  {   788,  11,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   810,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {   834,  18,  13,  18,    0,  -12 },   // 0x57 'W'
+  {   870,  11,  13,  12,    0,  -12 },   // 0x58 'X'
+  {   892,  11,  13,  11,    0,  -12 },   // 0x59 'Y'
+  {   914,  10,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   934,   4,  16,   5,    1,  -12 },   // 0x5B '['
+  {   942,   7,  14,   7,    0,  -12 },   // 0x5C '\'
+  {   956,   3,  16,   5,    1,  -12 },   // 0x5D ']'
+  {   962,   8,   6,  10,    1,  -12 },   // 0x5E '^'
+  {   970,   7,   1,   7,    0,    2 },   // 0x5F '_'
+  {   977,   4,   3,   6,    0,  -12 },   // 0x60 '`'
+  {   981,   7,   9,   9,    1,   -8 },   // 0x61 'a'
+  {   995,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {  1011,   7,   9,   8,    1,   -8 },   // 0x63 'c'
+  {  1025,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {  1041,   8,   9,   9,    1,   -8 },   // 0x65 'e'
+  {  1057,   6,  13,   6,    0,  -12 },   // 0x66 'f'
+  {  1069,   9,  12,   9,    0,   -8 },   // 0x67 'g'
+  {  1087,   8,  13,  10,    1,  -12 },   // 0x68 'h'
+  {  1103,   2,  13,   5,    1,  -12 },   // 0x69 'i'
+  {  1107,   4,  16,   5,   -1,  -12 },   // 0x6A 'j'
+  {  1115,   8,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {  1131,   2,  13,   5,    1,  -12 },   // 0x6C 'l'
+  {  1135,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
+  {  1161,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {  1177,   8,   9,  10,    1,   -8 },   // 0x6F 'o'
+  {  1193,   8,  12,  10,    1,   -8 },   // 0x70 'p'
+  {  1209,   8,  12,  10,    1,   -8 },   // 0x71 'q'
+  {  1225,   6,   9,   7,    1,   -8 },   // 0x72 'r'
+  {  1237,   6,   9,   8,    1,   -8 },   // 0x73 's'
+  {  1249,   6,  12,   7,    0,  -11 },   // 0x74 't'
+  {  1261,   8,   9,  10,    1,   -8 },   // 0x75 'u'
+  {  1277,   9,   9,   9,    0,   -8 },   // 0x76 'v'
+  {  1295,  14,   9,  14,    0,   -8 },   // 0x77 'w'
+  {  1323,   9,   9,   9,    0,   -8 },   // 0x78 'x'
+  {  1341,   9,  12,   9,    0,   -8 },   // 0x79 'y'
+  {  1359,   7,   9,   8,    1,   -8 },   // 0x7A 'z'
+  {  1373,   5,  16,   5,    0,  -12 },   // 0x7B '{'
+  {  1383,   1,  16,   5,    2,  -12 },   // 0x7C '|'
+  {  1385,   4,  16,   5,    1,  -12 },   // 0x7D '}'
+  {  1393,   8,   4,  10,    1,   -6 } }; // 0x7E '~'
+
+const GFXfont Lato9pt7bp PROGMEM = {
+  (uint8_t  *)Lato9pt7bpBitmaps,
+  (GFXglyph *)Lato9pt7bpGlyphs,
+  0x20, 0x7E, 21, GFXFONT_PAGES };
+
+// Approx. 2076 bytes
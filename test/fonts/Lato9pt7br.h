@@ -0,0 +1,191 @@
+const uint8_t Lato9pt7brBitmaps[] PROGMEM = {
+  0x07, 0x59, 0x41, 0x03, 0x14, 0x43, 0x14, 0x81, 0x81, 0x31, 0x31, 0x41,
+  0x35, 0x27, 0x45, 0x31, 0x81, 0x31, 0x13, 0x48, 0x17, 0x11, 0x42, 0x21,
+  0x31, 0x81, 0xB2, 0x55, 0x51, 0x42, 0x31, 0x52, 0x32, 0x32, 0x5F, 0x22,
+  0x25, 0x14, 0x23, 0x24, 0x23, 0x24, 0x15, 0x5C, 0x20, 0x15, 0x62, 0x51,
+  0x52, 0x51, 0x32, 0x11, 0x51, 0x22, 0x35, 0x22, 0x92, 0xA2, 0xA2, 0x24,
+  0x32, 0x31, 0x41, 0x12, 0x41, 0x43, 0x51, 0x42, 0x74, 0x84, 0x41, 0x32,
+  0x21, 0x27, 0x43, 0x33, 0x42, 0x52, 0x42, 0x62, 0x33, 0x62, 0x11, 0x22,
+  0x63, 0xA3, 0x83, 0x12, 0xC1, 0xC1, 0x03, 0x14, 0x57, 0x7D, 0x24, 0x94,
+  0x11, 0xD1, 0x03, 0xB3, 0x24, 0x54, 0x69, 0x11, 0x21, 0x32, 0x26, 0x22,
+  0x31, 0x21, 0x41, 0x81, 0x81, 0x81, 0x49, 0x41, 0x81, 0x81, 0x81, 0x01,
+  0x13, 0x04, 0x02, 0xC2, 0xA3, 0x83, 0x93, 0x84, 0x83, 0xB1, 0x29, 0x33,
+  0x53, 0x12, 0x93, 0xB2, 0xB2, 0xB1, 0x12, 0x72, 0x39, 0x57, 0x31, 0xB2,
+  0x81, 0x12, 0x9F, 0xCC, 0x1C, 0x1C, 0x10, 0x22, 0x72, 0x13, 0x65, 0x75,
+  0x73, 0x12, 0x63, 0x22, 0x53, 0x33, 0x24, 0x41, 0x15, 0x61, 0xC1, 0x31,
+  0x61, 0x33, 0x62, 0x12, 0x93, 0xB2, 0x51, 0x52, 0x51, 0x53, 0x33, 0x32,
+  0x15, 0x15, 0x92, 0x91, 0xA3, 0x92, 0x11, 0x73, 0x21, 0x62, 0x41, 0x52,
+  0x51, 0x33, 0x61, 0x3D, 0x91, 0xC1, 0xB1, 0x25, 0x55, 0x21, 0x62, 0x41,
+  0x62, 0x41, 0x62, 0x41, 0x53, 0x52, 0x22, 0x11, 0x55, 0x65, 0x77, 0x44,
+  0x42, 0x22, 0x11, 0x61, 0x12, 0x21, 0x63, 0x31, 0x62, 0x42, 0x41, 0x76,
+  0x92, 0x01, 0xC1, 0xB2, 0x94, 0x74, 0x11, 0x54, 0x31, 0x34, 0x51, 0x14,
+  0x74, 0x92, 0x23, 0x33, 0x35, 0x15, 0x12, 0x32, 0x52, 0x51, 0x52, 0x51,
+  0x52, 0x51, 0x51, 0x12, 0x12, 0x11, 0x32, 0x23, 0x25, 0xA1, 0x32, 0x96,
+  0x71, 0x42, 0x42, 0x61, 0x33, 0x61, 0x22, 0x11, 0x64, 0x22, 0x43, 0x57,
+  0x83, 0x01, 0x72, 0x71, 0x01, 0x71, 0x12, 0x73, 0x41, 0x62, 0x63, 0x42,
+  0x11, 0x41, 0x22, 0x22, 0x31, 0x12, 0x42, 0x01, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x21, 0x02, 0x42, 0x11, 0x41, 0x22, 0x22, 0x31, 0x21,
+  0x44, 0x52, 0x62, 0x11, 0xB2, 0xB1, 0xB2, 0x53, 0x32, 0x42, 0x75, 0x93,
+  0x46, 0x62, 0x62, 0x32, 0x82, 0x21, 0x52, 0x31, 0x11, 0x45, 0x32, 0x32,
+  0x31, 0x32, 0x31, 0x41, 0x32, 0x31, 0x31, 0x42, 0x36, 0x31, 0x11, 0x21,
+  0x41, 0x31, 0x11, 0x71, 0x21, 0x32, 0x41, 0x31, 0x45, 0xC1, 0x94, 0x74,
+  0x65, 0x64, 0x21, 0x44, 0x41, 0x43, 0x51, 0x54, 0x31, 0x85, 0xA4, 0xC4,
+  0xB2, 0x0E, 0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0x51, 0x51,
+  0x15, 0x11, 0x32, 0x14, 0x25, 0x92, 0x37, 0x59, 0x32, 0x72, 0x21, 0x93,
+  0xB2, 0xB2, 0xB2, 0xB3, 0x92, 0x11, 0x91, 0x21, 0x91, 0x0E, 0xB2, 0xB2,
+  0xB2, 0xB2, 0xB2, 0xB1, 0x11, 0x91, 0x23, 0x53, 0x39, 0x74, 0x0E, 0x51,
+  0x52, 0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0xB2, 0xB1, 0x0E,
+  0x51, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x61,
+  0x37, 0x59, 0x32, 0x72, 0x21, 0x91, 0x11, 0xB2, 0xB2, 0xB2, 0x61, 0x42,
+  0x61, 0x43, 0x51, 0x32, 0x11, 0x55, 0x0D, 0x61, 0xC1, 0xC1, 0xC1, 0xC1,
+  0xC1, 0xC1, 0x6F, 0xB0, 0x0F, 0xB0, 0xC1, 0xC1, 0xC1, 0xA2, 0x1C, 0x0D,
+  0x61, 0xC1, 0xB3, 0x92, 0x12, 0x72, 0x32, 0x43, 0x52, 0x23, 0x72, 0x11,
+  0xA3, 0xB1, 0x0D, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x0F, 0x1C, 0x3C,
+  0x3C, 0x3C, 0x3B, 0x29, 0x38, 0x38, 0x38, 0x39, 0xFB, 0x0D, 0x13, 0xB3,
+  0xB3, 0xC2, 0xC3, 0xB3, 0xC2, 0x29, 0x1F, 0x10, 0x37, 0x59, 0x32, 0x72,
+  0x21, 0x91, 0x11, 0xB2, 0xB2, 0xB2, 0xB3, 0x92, 0x11, 0x91, 0x32, 0x52,
+  0x57, 0x91, 0x0E, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x52,
+  0x62, 0x22, 0x75, 0x37, 0x89, 0x62, 0x72, 0x51, 0x91, 0x41, 0xB1, 0x31,
+  0xB1, 0x31, 0xB1, 0x31, 0xB1, 0x32, 0x92, 0x41, 0x93, 0x42, 0x53, 0x12,
+  0x48, 0x32, 0x62, 0x71, 0x0E, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x62,
+  0x42, 0x45, 0x36, 0x32, 0x34, 0x52, 0xC1, 0x23, 0x61, 0x25, 0x53, 0x33,
+  0x52, 0x42, 0x52, 0x43, 0x42, 0x52, 0x34, 0x46, 0x11, 0x64, 0x01, 0xC1,
+  0xC1, 0xC1, 0xCF, 0xCC, 0x1C, 0x1C, 0x10, 0x09, 0x4B, 0xC2, 0xC2, 0xC1,
+  0xC1, 0xC1, 0xB2, 0xA2, 0x1B, 0x29, 0x01, 0xC4, 0xB4, 0xB4, 0xC4, 0xB4,
+  0xA3, 0x75, 0x64, 0x65, 0x64, 0x92, 0x01, 0xC4, 0xB6, 0xA6, 0xA5, 0x94,
+  0x65, 0x55, 0x55, 0x84, 0xB5, 0xB5, 0xB5, 0xA3, 0x66, 0x46, 0x46, 0x72,
+  0x01, 0xB3, 0x95, 0x63, 0x33, 0x33, 0x56, 0x93, 0x94, 0x83, 0x13, 0x43,
+  0x53, 0x13, 0x74, 0xB1, 0x01, 0xC2, 0xC3, 0xC3, 0xB3, 0xC7, 0x58, 0x33,
+  0x93, 0x83, 0xA1, 0x01, 0xA3, 0x85, 0x73, 0x12, 0x63, 0x22, 0x43, 0x42,
+  0x33, 0x52, 0x13, 0x75, 0x84, 0x92, 0x0F, 0xF3, 0xE2, 0xE1, 0x02, 0xD3,
+  0xD3, 0xE3, 0xD3, 0xD3, 0xE1, 0x01, 0xE2, 0xEF, 0x20, 0x51, 0x42, 0x23,
+  0x13, 0x32, 0x53, 0x52, 0x61, 0x07, 0x01, 0x21, 0x22, 0x31, 0x11, 0x33,
+  0x12, 0x31, 0x13, 0x31, 0x32, 0x31, 0x32, 0x31, 0x39, 0x28, 0x0F, 0xB5,
+  0x15, 0x15, 0x17, 0x14, 0x17, 0x14, 0x17, 0x14, 0x33, 0x26, 0x70, 0x25,
+  0x32, 0x32, 0x11, 0x72, 0x72, 0x72, 0x71, 0x11, 0x51, 0x66, 0x62, 0x33,
+  0x41, 0x71, 0x41, 0x71, 0x41, 0x71, 0x42, 0x51, 0x1F, 0xB0, 0x25, 0x31,
+  0x11, 0x22, 0x11, 0x21, 0x33, 0x21, 0x42, 0x21, 0x42, 0x21, 0x41, 0x13,
+  0x32, 0x22, 0x31, 0x41, 0xC1, 0x9E, 0x21, 0x81, 0x31, 0x81, 0x31, 0x91,
+  0x33, 0x12, 0x13, 0x12, 0x15, 0x32, 0x31, 0x21, 0x32, 0x31, 0x21, 0x32,
+  0x31, 0x21, 0x36, 0x21, 0x26, 0x34, 0x11, 0x72, 0x0F, 0xB5, 0x1B, 0x1C,
+  0x1C, 0x1C, 0x95, 0x80, 0x01, 0x3A, 0x39, 0xF0, 0x1F, 0x02, 0x3D, 0x3B,
+  0x0F, 0xB8, 0x1B, 0x39, 0x21, 0x27, 0x23, 0x25, 0x25, 0x24, 0x17, 0x10,
+  0x0F, 0xB0, 0x0F, 0x31, 0x17, 0x18, 0x18, 0x28, 0x81, 0x17, 0x18, 0x18,
+  0x19, 0x82, 0x70, 0x0F, 0x31, 0x17, 0x18, 0x18, 0x18, 0x91, 0x80, 0x25,
+  0x32, 0x32, 0x11, 0x72, 0x72, 0x72, 0x71, 0x12, 0x32, 0x35, 0x0F, 0x91,
+  0x16, 0x13, 0x17, 0x13, 0x17, 0x13, 0x17, 0x13, 0x33, 0x25, 0x60, 0x26,
+  0x52, 0x33, 0x31, 0x71, 0x31, 0x71, 0x31, 0x71, 0x32, 0x51, 0x4F, 0x90,
+  0x0F, 0x31, 0x17, 0x18, 0x18, 0x10, 0x13, 0x34, 0x12, 0x32, 0x22, 0x32,
+  0x31, 0x32, 0x32, 0x12, 0x11, 0x33, 0x31, 0xB1, 0x8B, 0x41, 0x62, 0x31,
+  0x71, 0x31, 0x71, 0x08, 0x19, 0x81, 0x81, 0x81, 0x71, 0x1F, 0x30, 0x01,
+  0x83, 0x84, 0x74, 0x82, 0x54, 0x24, 0x34, 0x51, 0x01, 0x84, 0x75, 0x83,
+  0x54, 0x24, 0x33, 0x64, 0x84, 0x83, 0x54, 0x25, 0x24, 0x51, 0x01, 0x73,
+  0x55, 0x32, 0x35, 0x61, 0x65, 0x32, 0x32, 0x12, 0x53, 0x71, 0x01, 0xB3,
+  0xA4, 0x61, 0x44, 0x13, 0x64, 0x73, 0x64, 0x64, 0x81, 0x01, 0x63, 0x54,
+  0x33, 0x12, 0x22, 0x35, 0x44, 0x52, 0x71, 0x81, 0x84, 0x23, 0x14, 0x18,
+  0x18, 0xE2, 0xE1, 0x0F, 0x10, 0x01, 0xE3, 0x32, 0x31, 0x41, 0x17, 0x16,
+  0x91, 0x22, 0x12, 0x21, 0x31, 0x41, 0x31, 0x31, 0x13, 0x10 };
+
+const GFXglyph Lato9pt7brGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     0,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     3,   5,   4,   7,    1,  -12 },   // 0x22 '"'
+  {     7,  10,  13,  10,    0,  -12 },   // 0x23 '#'
+  {    26,   9,  16,  10,    1,  -13 },   // 0x24 '$'
+  {    45,  12,  13,  14,    1,  -12 },   // 0x25 '%'
+  {    69,  12,  13,  13,    1,  -12 },   // 0x26 '&'
+  {    90,   2,   4,   4,    1,  -12 },   // 0x27 '''
+  {    92,   4,  17,   5,    1,  -13 },   // 0x28 '('
+  {    98,   3,  17,   5,    1,  -13 },   // 0x29 ')'
+  {   103,   5,   6,   7,    1,  -12 },   // 0x2A '*'
+  {   110,   9,   9,  10,    1,  -10 },   // 0x2B '+'
+  {   119,   2,   3,   4,    1,    0 },   // 0x2C ','
+  {   121,   4,   1,   6,    1,   -5 },   // 0x2D '-'
+  {   122,   2,   1,   4,    1,    0 },   // 0x2E '.'
+  {   123,   7,  14,   7,    0,  -12 },   // 0x2F '/'
+  {   130,   9,  13,  10,    1,  -12 },   // 0x30 '0'
+  {   142,   8,  13,  10,    2,  -12 },   // 0x31 '1'
+  {   151,   9,  13,  10,    1,  -12 },   // 0x32 '2'
+  {   167,   9,  13,  10,    1,  -12 },   // 0x33 '3'
+  {   183,  10,  13,  10,    0,  -12 },   // 0x34 '4'
+  {   198,   8,  13,  10,    1,  -12 },   // 0x35 '5'
+  {   213,   9,  13,  10,    1,  -12 },   // 0x36 '6'
+  {   229,   9,  13,  10,    1,  -12 },   // 0x37 '7'
+  {   242,   9,  13,  10,    1,  -12 },   // 0x38 '8'
+  {   262,   9,  13,  10,    1,  -12 },   // 0x39 '9'
+  {   277,   2,   9,   5,    1,   -8 },   // 0x3A ':'
+  {   280,   2,  11,   5,    1,   -8 },   // 0x3B ';'
+  {   284,   7,   8,  10,    1,   -9 },   // 0x3C '<'
+  {   295,   8,   4,  10,    1,   -7 },   // 0x3D '='
+  {   304,   7,   8,  10,    2,   -9 },   // 0x3E '>'
+  {   315,   7,  13,   7,    0,  -12 },   // 0x3F '?'
+  {   324,  13,  14,  15,    1,  -11 },   // 0x40 '@'
+  {   357,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   373,   9,  13,  12,    2,  -12 },   // 0x42 'B'
+  {   390,  11,  13,  12,    1,  -12 },   // 0x43 'C'
+  {   405,  11,  13,  14,    2,  -12 },   // 0x44 'D'
+  {   418,   8,  13,  10,    2,  -12 },   // 0x45 'E'
+  {   431,   8,  13,  10,    2,  -12 },   // 0x46 'F'
+  {   444,  11,  13,  13,    1,  -12 },   // 0x47 'G'
+  {   462,  10,  13,  14,    2,  -12 },   // 0x48 'H'
+  {   472,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   474,   5,  13,   8,    1,  -12 },   // 0x4A 'J'
+  {   479,  10,  13,  12,    2,  -12 },   // 0x4B 'K'
+  {   494,   7,  13,   9,    2,  -12 },   // 0x4C 'L'
+  {   501,  13,  13,  17,    2,  -12 },   // 0x4D 'M'
+  {   513,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   524,  13,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   542,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   555,  13,  16,  14,    1,  -12 },   // 0x51 'Q'
+  {   580,   9,  13,  12,    2,  -12 },   // 0x52 'R'
+  {   595,   8,  13,  10,    1,  -12 },   // 0x53 'S'
+  {   610,  10,  13,  11,    0,  -12 },   // 0x54 'T'
+  {   619,  11,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   630,  12,  13,  12,    0,  -12 },   // 0x56 'V'
+  {   642,  18,  13,  18,    0,  -12 },   // 0x57 'W'
+  {   660,  11,  13,  12,    0,  -12 },   // 0x58 'X'
+  {   676,  11,  13,  11,    0,  -12 },   // 0x59 'Y'
+  {   687,  10,  13,  11,    1,  -12 },   // 0x5A 'Z'
+  {   702,   4,  16,   5,    1,  -12 },   // 0x5B '['
+  {   706,   7,  14,   7,    0,  -12 },   // 0x5C '\'
+  {   713,   3,  16,   5,    1,  -12 },   // 0x5D ']'
+  {   717,   8,   6,  10,    1,  -12 },   // 0x5E '^'
+  {   725,   7,   1,   7,    0,    2 },   // 0x5F '_'
+  {   726,   4,   3,   6,    0,  -12 },   // 0x60 '`'
+  {   730,   7,   9,   9,    1,   -8 },   // 0x61 'a'
+  {   742,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {   755,   7,   9,   8,    1,   -8 },   // 0x63 'c'
+  {   765,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {   778,   8,   9,   9,    1,   -8 },   // 0x65 'e'
+  {   795,   6,  13,   6,    0,  -12 },   // 0x66 'f'
+  {   803,   9,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   824,   8,  13,  10,    1,  -12 },   // 0x68 'h'
+  {   832,   2,  13,   5,    1,  -12 },   // 0x69 'i'
+  {   835,   4,  16,   5,   -1,  -12 },   // 0x6A 'j'
+  {   840,   8,  13,   9,    1,  -12 },   // 0x6B 'k'
+  {   852,   2,  13,   5,    1,  -12 },   // 0x6C 'l'
+  {   854,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
+  {   867,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   875,   8,   9,  10,    1,   -8 },   // 0x6F 'o'
+  {   886,   8,  12,  10,    1,   -8 },   // 0x70 'p'
+  {   899,   8,  12,  10,    1,   -8 },   // 0x71 'q'
+  {   912,   6,   9,   7,    1,   -8 },   // 0x72 'r'
+  {   918,   6,   9,   8,    1,   -8 },   // 0x73 's'
+  {   930,   6,  12,   7,    0,  -11 },   // 0x74 't'
+  {   939,   8,   9,  10,    1,   -8 },   // 0x75 'u'
+  {   947,   9,   9,   9,    0,   -8 },   // 0x76 'v'
+  {   956,  14,   9,  14,    0,   -8 },   // 0x77 'w'
+  {   970,   9,   9,   9,    0,   -8 },   // 0x78 'x'
+  {   982,   9,  12,   9,    0,   -8 },   // 0x79 'y'
+  {   993,   7,   9,   8,    1,   -8 },   // 0x7A 'z'
+  {  1003,   5,  16,   5,    0,  -12 },   // 0x7B '{'
+  {  1011,   1,  16,   5,    2,  -12 },   // 0x7C '|'
+  {  1013,   4,  16,   5,    1,  -12 },   // 0x7D '}'
+  {  1021,   8,   4,  10,    1,   -6 } }; // 0x7E '~'
+
+const GFXfont Lato9pt7br PROGMEM = {
+  (uint8_t  *)Lato9pt7brBitmaps,
+  (GFXglyph *)Lato9pt7brGlyphs,
+  0x20, 0x7E, 21, GFXFONT_RLE };
+
+// Approx. 1705 bytes
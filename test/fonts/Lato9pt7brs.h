@@ -0,0 +1,65 @@
+const uint8_t Lato9pt7brsBitmaps[] PROGMEM = {
+  0x07, 0x59, 0x41, 0x03, 0x14, 0x43, 0x14, 0x29, 0x33, 0x53, 0x12, 0x93,
+  0xB2, 0xB2, 0xB1, 0x12, 0x72, 0x39, 0x57, 0x31, 0xB2, 0x81, 0x12, 0x9F,
+  0xCC, 0x1C, 0x1C, 0x10, 0x22, 0x72, 0x13, 0x65, 0x75, 0x73, 0x12, 0x63,
+  0x22, 0x53, 0x33, 0x24, 0x41, 0x15, 0x61, 0xC1, 0x31, 0x61, 0x33, 0x62,
+  0x12, 0x93, 0xB2, 0x51, 0x52, 0x51, 0x53, 0x33, 0x32, 0x15, 0x15, 0x92,
+  0x01, 0xC1, 0xB2, 0x94, 0x74, 0x11, 0x54, 0x31, 0x34, 0x51, 0x14, 0x74,
+  0x92, 0x01, 0x72, 0x71, 0x02, 0x42, 0x11, 0x41, 0x22, 0x22, 0x31, 0x21,
+  0x44, 0x52, 0x62, 0xC1, 0x94, 0x74, 0x65, 0x64, 0x21, 0x44, 0x41, 0x43,
+  0x51, 0x54, 0x31, 0x85, 0xA4, 0xC4, 0xB2, 0x0E, 0x51, 0x52, 0x51, 0x52,
+  0x51, 0x52, 0x51, 0x52, 0x51, 0x52, 0xB2, 0xB1, 0x0F, 0xB0, 0x0D, 0xC1,
+  0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0x0D, 0x13, 0xB3, 0xB3, 0xC2, 0xC3, 0xB3,
+  0xC2, 0x29, 0x1F, 0x10, 0x37, 0x59, 0x32, 0x72, 0x21, 0x91, 0x11, 0xB2,
+  0xB2, 0xB2, 0xB3, 0x92, 0x11, 0x91, 0x32, 0x52, 0x57, 0x91, 0x0E, 0x61,
+  0x51, 0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x52, 0x62, 0x22, 0x75, 0x0E,
+  0x61, 0x51, 0x61, 0x51, 0x61, 0x51, 0x62, 0x42, 0x45, 0x36, 0x32, 0x34,
+  0x52, 0xC1, 0x23, 0x61, 0x25, 0x53, 0x33, 0x52, 0x42, 0x52, 0x43, 0x42,
+  0x52, 0x34, 0x46, 0x11, 0x64, 0x09, 0x4B, 0xC2, 0xC2, 0xC1, 0xC1, 0xC1,
+  0xB2, 0xA2, 0x1B, 0x29, 0x01, 0xC4, 0xB6, 0xA6, 0xA5, 0x94, 0x65, 0x55,
+  0x55, 0x84, 0xB5, 0xB5, 0xB5, 0xA3, 0x66, 0x46, 0x46, 0x72, 0x01, 0xC2,
+  0xC3, 0xC3, 0xB3, 0xC7, 0x58, 0x33, 0x93, 0x83, 0xA1, 0x91, 0x33, 0x12,
+  0x13, 0x12, 0x15, 0x32, 0x31, 0x21, 0x32, 0x31, 0x21, 0x32, 0x31, 0x21,
+  0x36, 0x21, 0x26, 0x34, 0x11, 0x72, 0x0F, 0x31, 0x17, 0x18, 0x18, 0x18,
+  0x91, 0x80, 0x25, 0x32, 0x32, 0x11, 0x72, 0x72, 0x72, 0x71, 0x12, 0x32,
+  0x35, 0x20 };
+
+const GFXglyph Lato9pt7brsGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     0,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     3,   5,   4,   7,    1,  -12 },   // 0x22 '"'
+  {     7,   9,  13,  10,    1,  -12 },   // 0x30 '0'
+  {    19,   8,  13,  10,    2,  -12 },   // 0x31 '1'
+  {    28,   9,  13,  10,    1,  -12 },   // 0x32 '2'
+  {    44,   9,  13,  10,    1,  -12 },   // 0x33 '3'
+  {    60,   9,  13,  10,    1,  -12 },   // 0x37 '7'
+  {    73,   2,   9,   5,    1,   -8 },   // 0x3A ':'
+  {    76,   7,   8,  10,    2,   -9 },   // 0x3E '>'
+  {    87,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   103,   8,  13,  10,    2,  -12 },   // 0x45 'E'
+  {   116,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   118,   7,  13,   9,    2,  -12 },   // 0x4C 'L'
+  {   125,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   136,  13,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   154,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   167,   9,  13,  12,    2,  -12 },   // 0x52 'R'
+  {   182,   8,  13,  10,    1,  -12 },   // 0x53 'S'
+  {   197,  11,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   208,  18,  13,  18,    0,  -12 },   // 0x57 'W'
+  {   226,  11,  13,  11,    0,  -12 },   // 0x59 'Y'
+  {   237,   9,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   258,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   266,   8,   9,  10,    1,   -8 } }; // 0x6F 'o'
+
+const uint8_t Lato9pt7brsIndex[] PROGMEM = {
+  0x20, 0x21, 0x22, 0x30, 0x31, 0x32, 0x33, 0x37, 0x3A, 0x3E, 0x41, 0x45,
+  0x49, 0x4C, 0x4E, 0x4F, 0x50, 0x52, 0x53, 0x55, 0x57, 0x59, 0x67, 0x6E,
+  0x6F };
+
+const GFXfont Lato9pt7brs PROGMEM = {
+  (uint8_t  *)Lato9pt7brsBitmaps,
+  (GFXglyph *)Lato9pt7brsGlyphs,
+  0x20, 0x6F, 21, GFXFONT_RLE,
+  (uint8_t  *)Lato9pt7brsIndex };
+
+// Approx. 488 bytes
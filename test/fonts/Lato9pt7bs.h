@@ -0,0 +1,68 @@
+const uint8_t Lato9pt7bsBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFD, 0x00, 0xC0, 0xDE, 0xF6, 0x90, 0x3C, 0x31, 0x30, 0xD8,
+  0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xE0, 0xF0, 0xCC, 0x43, 0xC0, 0x18,
+  0x38, 0x78, 0xD8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x7F,
+  0x3E, 0x31, 0xB0, 0x58, 0x20, 0x30, 0x18, 0x18, 0x1C, 0x1C, 0x1C, 0x1C,
+  0x1C, 0x0F, 0xF8, 0x3E, 0x31, 0x90, 0x58, 0x20, 0x10, 0x18, 0x38, 0x06,
+  0x01, 0x80, 0xF0, 0x4C, 0x63, 0xE0, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0x60,
+  0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x00, 0xC0, 0x00, 0xC0,
+  0x81, 0xC0, 0xE0, 0x70, 0xE7, 0x38, 0x40, 0x06, 0x00, 0x70, 0x0F, 0x00,
+  0xD0, 0x19, 0x81, 0x88, 0x10, 0xC3, 0x0C, 0x3F, 0xC6, 0x06, 0x60, 0x24,
+  0x03, 0xC0, 0x30, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFC, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x81, 0x02, 0x04, 0x08,
+  0x10, 0x20, 0x40, 0x81, 0x02, 0x04, 0x0F, 0xE0, 0x80, 0xF0, 0x3E, 0x0F,
+  0xC3, 0xB0, 0xE6, 0x38, 0xCE, 0x1B, 0x86, 0xE0, 0xD8, 0x1E, 0x03, 0x80,
+  0xC0, 0x0F, 0x81, 0x86, 0x18, 0x09, 0x80, 0x6C, 0x01, 0x60, 0x0B, 0x00,
+  0x78, 0x02, 0xC0, 0x16, 0x01, 0x98, 0x08, 0x61, 0x80, 0xF8, 0x00, 0xFC,
+  0x83, 0x83, 0x81, 0x81, 0x83, 0x86, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xFC, 0x43, 0x20, 0xD0, 0x68, 0x34, 0x1A, 0x19, 0xF8, 0x8C, 0x42, 0x21,
+  0x90, 0x68, 0x18, 0x3F, 0x42, 0xC0, 0xC0, 0xE0, 0x78, 0x3E, 0x0F, 0x03,
+  0x03, 0x03, 0xC6, 0x7C, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80,
+  0xF0, 0x1E, 0x03, 0xC0, 0x68, 0x09, 0x83, 0x18, 0xC1, 0xF0, 0xC0, 0xC0,
+  0xD0, 0x30, 0x36, 0x0E, 0x09, 0x87, 0x86, 0x21, 0xA1, 0x8C, 0x4C, 0x63,
+  0x33, 0x30, 0xCC, 0x4C, 0x1A, 0x1B, 0x07, 0x86, 0x81, 0xE0, 0xE0, 0x30,
+  0x38, 0x0C, 0x0C, 0x00, 0xC0, 0x6C, 0x08, 0x83, 0x18, 0xC1, 0x98, 0x36,
+  0x03, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x3F, 0xB1,
+  0x90, 0xCC, 0x63, 0xE3, 0x01, 0x80, 0x7E, 0x41, 0xE0, 0xD0, 0xC7, 0xC0,
+  0xDE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x3C, 0x42, 0xC3,
+  0x81, 0x81, 0x81, 0xC3, 0x42, 0x3C };
+
+const GFXglyph Lato9pt7bsGlyphs[] PROGMEM = {
+  {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
+  {     1,   2,  13,   6,    2,  -12 },   // 0x21 '!'
+  {     5,   5,   4,   7,    1,  -12 },   // 0x22 '"'
+  {     8,   9,  13,  10,    1,  -12 },   // 0x30 '0'
+  {    23,   8,  13,  10,    2,  -12 },   // 0x31 '1'
+  {    36,   9,  13,  10,    1,  -12 },   // 0x32 '2'
+  {    51,   9,  13,  10,    1,  -12 },   // 0x33 '3'
+  {    66,   9,  13,  10,    1,  -12 },   // 0x37 '7'
+  {    81,   2,   9,   5,    1,   -8 },   // 0x3A ':'
+  {    84,   7,   8,  10,    2,   -9 },   // 0x3E '>'
+  {    91,  12,  13,  12,    0,  -12 },   // 0x41 'A'
+  {   111,   8,  13,  10,    2,  -12 },   // 0x45 'E'
+  {   124,   2,  13,   6,    2,  -12 },   // 0x49 'I'
+  {   128,   7,  13,   9,    2,  -12 },   // 0x4C 'L'
+  {   140,  10,  13,  14,    2,  -12 },   // 0x4E 'N'
+  {   157,  13,  13,  14,    1,  -12 },   // 0x4F 'O'
+  {   179,   8,  13,  11,    2,  -12 },   // 0x50 'P'
+  {   192,   9,  13,  12,    2,  -12 },   // 0x52 'R'
+  {   207,   8,  13,  10,    1,  -12 },   // 0x53 'S'
+  {   220,  11,  13,  13,    1,  -12 },   // 0x55 'U'
+  {   238,  18,  13,  18,    0,  -12 },   // 0x57 'W'
+  {   268,  11,  13,  11,    0,  -12 },   // 0x59 'Y'
+  {   286,   9,  12,   9,    0,   -8 },   // 0x67 'g'
+  {   300,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   309,   8,   9,  10,    1,   -8 } }; // 0x6F 'o'
+
+const uint8_t Lato9pt7bsIndex[] PROGMEM = {
+  0x20, 0x21, 0x22, 0x30, 0x31, 0x32, 0x33, 0x37, 0x3A, 0x3E, 0x41, 0x45,
+  0x49, 0x4C, 0x4E, 0x4F, 0x50, 0x52, 0x53, 0x55, 0x57, 0x59, 0x67, 0x6E,
+  0x6F };
+
+const GFXfont Lato9pt7bs PROGMEM = {
+  (uint8_t  *)Lato9pt7bsBitmaps,
+  (GFXglyph *)Lato9pt7bsGlyphs,
+  0x20, 0x6F, 21, 0,
+  (uint8_t  *)Lato9pt7bsIndex };
+
+// Approx. 528 bytes
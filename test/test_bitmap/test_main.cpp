@@ -0,0 +1,147 @@
+// drawPageBitmap() against a pixel-by-pixel reference: each raster op
+// must combine the bitmap with what is underneath exactly, at every row
+// offset within a page, clipped at every edge and in every rotation.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+#define MAX_SIZE 128
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t expected[BUFFER_SIZE];
+
+// page format, a byte per column for each 8 rows, bits below h clear
+static uint8_t bitmap[MAX_SIZE * MAX_SIZE / 8];
+
+static bool bitmapPixel(int i, int j, int w) {
+	return bitmap[(j / 8) * w + i] & (1 << (j & 7));
+}
+
+static void randomBitmap(int w, int h) {
+	memset(bitmap, 0, sizeof bitmap);
+	for (int j = 0; j < h; j++) {
+		for (int i = 0; i < w; i++) {
+			if (rand() & 1)
+				bitmap[(j / 8) * w + i] |= 1 << (j & 7);
+		}
+	}
+}
+
+// the same scattered pixels under both versions, so every op shows; a
+// generator of its own, to leave rand() to the test cases
+static void drawBackground(unsigned seed) {
+	uint32_t r = seed;
+	for (int i = 0; i < 600; i++) {
+		r = r * 1103515245 + 12345;
+		int x = (r >> 8) % display.width();
+		r = r * 1103515245 + 12345;
+		display.drawPixel(x, (r >> 8) % display.height(), WHITE);
+	}
+}
+
+// what each op means, a pixel at a time
+static void referenceBitmap(int x, int y, int w, int h, uint8_t op) {
+	for (int j = 0; j < h; j++) {
+		for (int i = 0; i < w; i++) {
+			bool set = bitmapPixel(i, j, w);
+			switch (op) {
+			case SSD1306_COPY: display.drawPixel(x + i, y + j, set ? WHITE : BLACK); break;
+			case SSD1306_OR:   if (set) display.drawPixel(x + i, y + j, WHITE); break;
+			case SSD1306_AND:  if (!set) display.drawPixel(x + i, y + j, BLACK); break;
+			case SSD1306_XOR:  if (set) display.drawPixel(x + i, y + j, INVERSE); break;
+			}
+		}
+	}
+}
+
+static void drawBitmap(bool reference, int x, int y, int w, int h, uint8_t op, unsigned seed) {
+	display.firstPage();
+	do {
+		drawBackground(seed);
+		if (reference)
+			referenceBitmap(x, y, w, h, op);
+		else
+			display.drawPageBitmap(x, y, bitmap, w, h, op);
+	} while (display.nextPage());
+}
+
+// begin() before each draw sends the whole panel: with so many different
+// backgrounds the shadow frame would, now and then, skip a changed chunk
+// whose CRC matches the old one
+static void checkBitmap(int x, int y, int w, int h, uint8_t op, unsigned seed) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	drawBitmap(true, x, y, w, h, op, seed);
+	memcpy(expected, model_gddram(), BUFFER_SIZE);
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	drawBitmap(false, x, y, w, h, op, seed);
+
+	char message[64];
+	snprintf(message, sizeof message, "%dx%d at %d,%d op %d rotation %d", w, h, x, y, op, display.getRotation());
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, model_gddram(), BUFFER_SIZE, message);
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+}
+
+void tearDown(void) {
+#ifndef SSD1306_ROTATION
+	display.setRotation(0);
+#endif
+}
+
+// sizes and positions anywhere around the panel, all four ops
+void test_random_bitmaps(void) {
+	srand(1);
+	for (int n = 0; n < 20000; n++) {
+#ifndef SSD1306_ROTATION
+		display.setRotation(n & 3);
+#endif
+		int w = rand() % 40 + 1, h = rand() % 40 + 1;
+		int x = rand() % (display.width() + 2 * w) - w;
+		int y = rand() % (display.height() + 2 * h) - h;
+		uint8_t op = rand() % 4;
+		unsigned seed = rand();
+		randomBitmap(w, h);
+		checkBitmap(x, y, w, h, op, seed);
+	}
+}
+
+// every row offset of a bitmap a few pages tall, and whole pages in place
+void test_row_offsets(void) {
+	srand(2);
+	randomBitmap(20, 24);
+	for (int y = -9; y <= 17; y++) {
+		for (uint8_t op = SSD1306_COPY; op <= SSD1306_XOR; op++)
+			checkBitmap(30, y, 20, 24, op, y + 100);
+	}
+}
+
+// the whole panel, a single pixel and a single row or column, and
+// bitmaps hanging off each edge
+void test_edges(void) {
+	static const int cases[][4] = {
+		{0, 0, 128, 64}, {0, 0, 1, 1}, {127, 63, 1, 1}, {5, 9, 1, 30}, {0, 13, 128, 1},
+		{-10, 4, 30, 12}, {110, 4, 30, 12}, {40, -7, 20, 12}, {40, 58, 20, 12},
+		{-5, -5, 10, 10}, {123, 59, 10, 10}, {-30, 20, 30, 8}, {128, 20, 8, 8}
+	};
+	srand(3);
+	for (unsigned n = 0; n < sizeof cases / sizeof cases[0]; n++) {
+		randomBitmap(cases[n][2], cases[n][3]);
+		for (uint8_t op = SSD1306_COPY; op <= SSD1306_XOR; op++)
+			checkBitmap(cases[n][0], cases[n][1], cases[n][2], cases[n][3], op, n);
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_random_bitmaps);
+	RUN_TEST(test_row_offsets);
+	RUN_TEST(test_edges);
+	return UNITY_END();
+}
@@ -0,0 +1,117 @@
+// The classic-font drawChar() of Adafruit_SSD1306, a glyph column byte at
+// a time with the sizes stretched through nibble tables, against the
+// generic one in Adafruit_GFX_Core: every glyph, sizes 1 to 5, clear and
+// filled backgrounds, with and without cp437, on and off the panel.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+typedef Adafruit_GFX_Core<Adafruit_GFX> Generic;
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t generic[BUFFER_SIZE];
+
+// color and bg: bg == color leaves the background alone
+static const uint16_t colors[][2] = {
+	{WHITE, WHITE}, {WHITE, BLACK}, {BLACK, BLACK}, {BLACK, WHITE}, {INVERSE, INVERSE}, {INVERSE, BLACK}
+};
+
+#define COLOR_COUNT (sizeof colors / sizeof colors[0])
+
+// stripes underneath, so clearing and flipping show up
+static void drawChar(bool own, int x, int y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size) {
+	Adafruit_GFX &gfx = display;
+
+	display.firstPage();
+	do {
+		for (int i = 0; i < SSD1306_LCDWIDTH; i += 3)
+			display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+		if (own)
+			display.drawChar(x, y, c, color, bg, size);
+		else
+			Generic::drawChar(gfx, x, y, c, color, bg, size);
+	} while (display.nextPage());
+}
+
+static void checkChar(int x, int y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size, bool cp437) {
+	display.cp437(cp437);
+	drawChar(false, x, y, c, color, bg, size);
+	memcpy(generic, model_gddram(), BUFFER_SIZE);
+	drawChar(true, x, y, c, color, bg, size);
+
+	char message[80];
+	snprintf(message, sizeof message, "0x%02X at %d,%d size %d color %d bg %d%s rotation %d",
+		c, x, y, size, color, bg, cp437 ? " cp437" : "", display.getRotation());
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(generic, model_gddram(), BUFFER_SIZE, message);
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+}
+
+void tearDown(void) {
+	display.cp437(false);
+#ifndef SSD1306_ROTATION
+	display.setRotation(0);
+#endif
+}
+
+// each of the 256 glyphs at a row offset within a page, the codes from
+// 176 up shifted by one without cp437
+void test_every_glyph(void) {
+	for (int c = 0; c < 256; c++) {
+		for (uint8_t size = 1; size <= 5; size++) {
+			for (unsigned k = 0; k < COLOR_COUNT; k++) {
+				checkChar(10, 3, c, colors[k][0], colors[k][1], size, false);
+				checkChar(10, 3, c, colors[k][0], colors[k][1], size, true);
+			}
+		}
+	}
+}
+
+// every row offset, and the cell hanging off each edge or just beyond it
+void test_positions(void) {
+	static const int xs[] = {-31, -6, -5, -1, 0, 3, 100, 122, 123, 127, 128};
+	static const int ys[] = {-41, -9, -8, -3, 0, 1, 4, 7, 8, 13, 30, 57, 60, 63, 64};
+	static const unsigned char chars[] = {'A', 'g', 0x7F, 0xB1, 0xDB};
+
+	for (unsigned n = 0; n < sizeof chars / sizeof chars[0]; n++) {
+		for (uint8_t size = 1; size <= 5; size++) {
+			for (unsigned i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+				for (unsigned j = 0; j < sizeof ys / sizeof ys[0]; j++) {
+					for (unsigned k = 0; k < COLOR_COUNT; k++)
+						checkChar(xs[i], ys[j], chars[n], colors[k][0], colors[k][1], size, n & 1);
+				}
+			}
+		}
+	}
+}
+
+// anywhere, in every rotation
+void test_random_chars(void) {
+	srand(1);
+	for (int n = 0; n < 20000; n++) {
+#ifndef SSD1306_ROTATION
+		display.setRotation(n & 3);
+#endif
+		uint8_t size = rand() % 5 + 1;
+		int x = rand() % (display.width() + 12 * size) - 6 * size;
+		int y = rand() % (display.height() + 16 * size) - 8 * size;
+		unsigned k = rand() % COLOR_COUNT;
+		checkChar(x, y, rand() % 256, colors[k][0], colors[k][1], size, rand() & 1);
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_every_glyph);
+	RUN_TEST(test_positions);
+	RUN_TEST(test_random_chars);
+	return UNITY_END();
+}
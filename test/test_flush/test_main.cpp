@@ -0,0 +1,109 @@
+// Bytes on the wire per display(), counted by the panel model in
+// lib/ArduinoNative, for the frames Pong sends: nothing moved, the ball
+// moved, the ball and a paddle moved.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include "ssd1306_model.h"
+
+static Adafruit_SSD1306 display(-1);
+
+static bool panelPixel(int x, int y) {
+	return model_gddram()[(y / 8) * MODEL_WIDTH + x] & (1 << (y & 7));
+}
+
+static void drawPaddle(int x, int y, uint16_t color) {
+	display.fillRect(x, y, 4, 20, color);
+}
+
+static void drawBall(int x, int y, uint16_t color) {
+	display.fillRect(x - 4, y - 4, 9, 9, BLACK);
+	if (color == WHITE)
+		display.drawCircle(x, y, 4, WHITE);
+}
+
+// a whole frame: net, paddles, ball and scores
+static void drawFrame(void) {
+	display.clearDisplay();
+	for (int y = 0; y < 64; y += 8)
+		display.fillRect(63, y, 4, 4, WHITE);
+	drawPaddle(0, 22, WHITE);
+	drawPaddle(124, 30, WHITE);
+	drawBall(40, 30, WHITE);
+	display.setTextSize(2);
+	display.setTextColor(WHITE);
+	display.setCursor(45, 0);
+	display.print(3);
+	display.setCursor(75, 0);
+	display.print(7);
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	drawFrame();
+	display.display();
+	model_reset_stats();
+}
+
+void tearDown(void) {
+}
+
+void test_nothing_moved(void) {
+	display.display();
+	TEST_ASSERT_EQUAL(0, model_stats().bytes);
+}
+
+void test_ball_moved(void) {
+	drawBall(40, 30, BLACK);
+	drawBall(45, 30, WHITE);
+	display.display();
+
+	// columns 36..49 of pages 3 and 4
+	TEST_ASSERT_EQUAL(28, model_stats().dataBytes);
+	TEST_ASSERT_LESS_THAN(64, model_stats().bytes);
+	TEST_ASSERT_TRUE(panelPixel(49, 30));
+	TEST_ASSERT_FALSE(panelPixel(36, 30));
+}
+
+void test_ball_and_paddle_moved(void) {
+	drawBall(40, 30, BLACK);
+	drawBall(45, 30, WHITE);
+	drawPaddle(0, 22, BLACK);
+	drawPaddle(0, 23, WHITE);
+	display.display();
+
+#ifdef SSD1306_SHADOW_FRAME
+	// only the chunks that changed: the paddle's ends in pages 2 and 5,
+	// the ball's columns in pages 3 and 4
+	TEST_ASSERT_EQUAL(16 + 18 + 18 + 16, model_stats().dataBytes);
+#else
+	// the box around both, columns 0..49 of pages 2..5
+	TEST_ASSERT_EQUAL(50 * 4, model_stats().dataBytes);
+#endif
+	TEST_ASSERT_FALSE(panelPixel(0, 22));
+	TEST_ASSERT_TRUE(panelPixel(0, 42));
+	TEST_ASSERT_TRUE(panelPixel(49, 30));
+}
+
+// the unmodified clear-and-redraw loop
+void test_same_frame_redrawn(void) {
+	drawFrame();
+	display.display();
+
+#ifdef SSD1306_SHADOW_FRAME
+	TEST_ASSERT_EQUAL(0, model_stats().dataBytes);
+	TEST_ASSERT_EQUAL(SSD1306_CHUNKS, display.getSkippedChunks());
+#else
+	TEST_ASSERT_EQUAL(SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8, model_stats().dataBytes);
+#endif
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_nothing_moved);
+	RUN_TEST(test_ball_moved);
+	RUN_TEST(test_ball_and_paddle_moved);
+	RUN_TEST(test_same_frame_redrawn);
+	return UNITY_END();
+}
@@ -0,0 +1,146 @@
+// Font encodings: the same font converted with fontconvert's default
+// row-major encoding, with -p (GFXFONT_PAGES) and with -r (GFXFONT_RLE)
+// must keep the same glyph boxes and draw the same pixels, through the
+// SSD1306's own glyph code and through Adafruit_GFX's.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include "ssd1306_model.h"
+
+#include "../fonts/Lato9pt7b.h"
+#include "../fonts/Lato9pt7bp.h"
+#include "../fonts/Lato9pt7br.h"
+#include "../fonts/Lato24pt7bs.h"
+#include "../fonts/Lato24pt7brs.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+typedef Adafruit_GFX_Core<Adafruit_SSD1306> Generic;
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t rowMajor[BUFFER_SIZE];
+
+static const char *const text9[] = {
+	" !\"#$%&'()*+,-./", "0123456789:;<=>?", "@ABCDEFGHIJKLMNO",
+	"PQRSTUVWXYZ[\\]^_", "`abcdefghijklmno", "pqrstuvwxyz{|}~"
+};
+
+static const char *const text24[] = {"0123", "4567", "89@%", "MWgjy", "A1z"};
+
+// stripes underneath, so clearing and flipping show up
+static void drawText(const GFXfont *font, bool generic, int x, int y, const char *text, uint16_t color, uint8_t size) {
+	display.firstPage();
+	do {
+		for (int i = 0; i < SSD1306_LCDWIDTH; i += 8)
+			display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+		display.setFont(font);
+		display.setTextSize(size);
+		display.setTextColor(color);
+		if (generic) {
+			// Adafruit_GFX's glyph code, which the SSD1306 only uses above size 1
+			for (int cx = x; *text; text++) {
+				Generic::drawChar(display, cx, y, *text, color, color, size);
+				GFXglyph *glyph = Adafruit_GFX_findGlyph(font, *text);
+				if (glyph)
+					cx += glyph->xAdvance * size;
+			}
+		} else {
+			display.setCursor(x, y);
+			display.print(text);
+		}
+	} while (display.nextPage());
+}
+
+static void checkText(const GFXfont *reference, const GFXfont *font, bool generic, int x, int y, const char *text, uint16_t color, uint8_t size) {
+	drawText(reference, generic, x, y, text, color, size);
+	memcpy(rowMajor, model_gddram(), BUFFER_SIZE);
+	drawText(font, generic, x, y, text, color, size);
+
+	char message[80];
+	snprintf(message, sizeof message, "\"%s\" at %d,%d color %d size %d%s", text, x, y, color, size, generic ? " generic" : "");
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(rowMajor, model_gddram(), BUFFER_SIZE, message);
+}
+
+// every row offset within a page, and text hanging off each edge
+static void checkFont(const GFXfont *reference, const GFXfont *font, const char *const *texts, int count) {
+	static const int xs[] = {-7, 0, 3, 70};
+	static const int ys[] = {-3, 5, 12, 13, 14, 20, 31, 36, 60, 70};
+
+	for (int t = 0; t < count; t++) {
+		for (unsigned i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+			for (unsigned j = 0; j < sizeof ys / sizeof ys[0]; j++) {
+				for (uint16_t color = BLACK; color <= INVERSE; color++) {
+					checkText(reference, font, false, xs[i], ys[j], texts[t], color, 1);
+					checkText(reference, font, true, xs[i], ys[j], texts[t], color, 1);
+				}
+				checkText(reference, font, false, xs[i], ys[j], texts[t], WHITE, 2);
+			}
+		}
+	}
+}
+
+static void checkGlyphBoxes(const GFXfont *reference, const GFXfont *font) {
+	TEST_ASSERT_EQUAL(reference->first, font->first);
+	TEST_ASSERT_EQUAL(reference->last, font->last);
+	TEST_ASSERT_EQUAL(reference->yAdvance, font->yAdvance);
+
+	for (int c = reference->first; c <= reference->last; c++) {
+		GFXglyph *a = Adafruit_GFX_findGlyph(reference, c);
+		GFXglyph *b = Adafruit_GFX_findGlyph(font, c);
+		TEST_ASSERT_EQUAL(a == NULL, b == NULL);
+		if (!a)
+			continue;
+		TEST_ASSERT_EQUAL(a->width, b->width);
+		TEST_ASSERT_EQUAL(a->height, b->height);
+		TEST_ASSERT_EQUAL(a->xAdvance, b->xAdvance);
+		TEST_ASSERT_EQUAL(a->xOffset, b->xOffset);
+		TEST_ASSERT_EQUAL(a->yOffset, b->yOffset);
+	}
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	display.setTextWrap(false);
+}
+
+void tearDown(void) {
+	display.setFont(NULL);
+	display.setTextSize(1);
+}
+
+void test_glyph_boxes_kept(void) {
+	checkGlyphBoxes(&Lato9pt7b, &Lato9pt7bp);
+	checkGlyphBoxes(&Lato9pt7b, &Lato9pt7br);
+	checkGlyphBoxes(&Lato24pt7bs, &Lato24pt7brs);
+}
+
+void test_pages_draw_like_rows(void) {
+	checkFont(&Lato9pt7b, &Lato9pt7bp, text9, sizeof text9 / sizeof text9[0]);
+}
+
+void test_rle_draws_like_rows(void) {
+	checkFont(&Lato9pt7b, &Lato9pt7br, text9, sizeof text9 / sizeof text9[0]);
+}
+
+// large glyphs have runs of 15 pixels and more, and a subset's glyphs
+// end where the next one in the index begins
+void test_rle_subset_draws_like_rows(void) {
+	checkFont(&Lato24pt7bs, &Lato24pt7brs, text24, sizeof text24 / sizeof text24[0]);
+}
+
+void test_rle_smaller_than_rows(void) {
+	TEST_ASSERT_LESS_THAN(sizeof Lato9pt7bBitmaps, sizeof Lato9pt7brBitmaps);
+	TEST_ASSERT_LESS_THAN(sizeof Lato24pt7bsBitmaps, sizeof Lato24pt7brsBitmaps);
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_glyph_boxes_kept);
+	RUN_TEST(test_pages_draw_like_rows);
+	RUN_TEST(test_rle_draws_like_rows);
+	RUN_TEST(test_rle_subset_draws_like_rows);
+	RUN_TEST(test_rle_smaller_than_rows);
+	return UNITY_END();
+}
@@ -0,0 +1,101 @@
+// The sketch's incremental renderer: after every loop(), the panel must
+// show exactly what clearing the buffer and drawing the whole frame again
+// shows, through paddle jumps, goals, score changes and game overs.
+//
+//   platformio test -e native
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+// the sketch itself, with its globals, so the test can drive and inspect it
+#include "../../src/arduino_pong.cpp"
+
+#ifndef INCREMENTAL_RENDER
+#error "test_incremental needs the single buffered incremental renderer"
+#endif
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+void native_advance_micros(unsigned long us);
+
+static uint8_t incremental[BUFFER_SIZE];
+
+static void sampleAdc(uint16_t value) {
+	ADCL = value & 0xFF;
+	ADCH = value >> 8;
+	ADC_vect();
+}
+
+// what the panel shows with the frame drawn from scratch
+static void redrawWhole(void) {
+	display.clearDisplay();
+	drawFrame(isGameOver());
+	display.display();
+}
+
+// the sketch's globals as they are at power on
+static void resetSketch(void) {
+	player = playerData();
+	ai = playerData();
+	ball = ballData();
+	drawn = frameState();
+}
+
+static void playAndCompare(unsigned long frames, unsigned seed) {
+	srand(seed);
+	setup();
+
+	for (unsigned long frame = 0; frame < frames; frame++) {
+		// mostly a steady hand, sometimes a jump to anywhere
+		sampleAdc((rand() % 8) ? (frame * 4) % 1024 : rand() % 1024);
+		unsigned long tick = nextTick;
+		loop();
+		if (nextTick == tick) {
+			// no game update fell due, so nothing was drawn
+			native_advance_micros(rand() % TICK_MICROS);
+			continue;
+		}
+		display.waitFlush();
+		memcpy(incremental, model_gddram(), BUFFER_SIZE);
+
+		redrawWhole();
+
+		char message[48];
+		snprintf(message, sizeof message, "frame %lu, seed %u", frame, seed);
+		TEST_ASSERT_EQUAL_MEMORY_MESSAGE(model_gddram(), incremental, BUFFER_SIZE, message);
+
+		// none to several game updates before the next frame
+		native_advance_micros(rand() % (3 * TICK_MICROS));
+
+		if (isGameOver() && !(rand() % 16)) {
+			// start again, back through the full redraw
+			player.score = 0;
+			ai.score = 0;
+		}
+	}
+}
+
+void setUp(void) {
+	resetSketch();
+}
+
+void tearDown(void) {
+}
+
+void test_incremental_matches_full_redraw(void) {
+	playAndCompare(20000, 1);
+}
+
+// near the end of a game the scores go to two digits and back
+void test_incremental_matches_full_redraw_late_game(void) {
+	player.score = 8;
+	ai.score = 8;
+	playAndCompare(5000, 2);
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_incremental_matches_full_redraw);
+	RUN_TEST(test_incremental_matches_full_redraw_late_game);
+	return UNITY_END();
+}
@@ -0,0 +1,139 @@
+// The buffer-pointer lines and circles of Adafruit_SSD1306 against the
+// generic per-pixel ones in Adafruit_GFX_Core: drawLine() and drawCircle()
+// must set the same pixels, on and off the panel, in every rotation and
+// colour, INVERSE pixels drawn twice included.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+typedef Adafruit_GFX_Core<Adafruit_GFX> Generic;
+
+typedef enum {
+	Shape_Line,
+	Shape_Circle
+} Shape;
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t generic[BUFFER_SIZE];
+
+// stripes underneath, so clearing and flipping show up
+static void drawStripes(int offset) {
+	for (int i = offset % 8; i < SSD1306_LCDWIDTH; i += 8)
+		display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+}
+
+// a circle is x0,y0 and radius r, a line runs from x0,y0 to x1,y1
+static void drawShape(bool own, Shape shape, int x0, int y0, int x1, int y1, int r, uint16_t color, int offset) {
+	Adafruit_GFX &gfx = display;
+
+	display.firstPage();
+	do {
+		drawStripes(offset);
+		if (shape == Shape_Line) {
+			if (own)
+				display.drawLine(x0, y0, x1, y1, color);
+			else
+				Generic::drawLine(gfx, x0, y0, x1, y1, color);
+		} else {
+			if (own)
+				display.drawCircle(x0, y0, r, color);
+			else
+				Generic::drawCircle(gfx, x0, y0, r, color);
+		}
+	} while (display.nextPage());
+}
+
+static void checkShape(Shape shape, int x0, int y0, int x1, int y1, int r, uint16_t color, int offset) {
+	drawShape(false, shape, x0, y0, x1, y1, r, color, offset);
+	memcpy(generic, model_gddram(), BUFFER_SIZE);
+	drawShape(true, shape, x0, y0, x1, y1, r, color, offset);
+
+	char message[80];
+	if (shape == Shape_Line) {
+		snprintf(message, sizeof message, "drawLine %d,%d to %d,%d color %d rotation %d",
+			x0, y0, x1, y1, color, display.getRotation());
+	} else {
+		snprintf(message, sizeof message, "drawCircle %d,%d r %d color %d rotation %d",
+			x0, y0, r, color, display.getRotation());
+	}
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(generic, model_gddram(), BUFFER_SIZE, message);
+}
+
+// mostly on the panel, where the buffer-pointer code runs, and a quarter
+// anywhere around it
+static int randomCoordinate(int size, bool anywhere) {
+	return anywhere ? rand() % (size + 60) - 30 : rand() % size;
+}
+
+static void checkRandomShapes(Shape shape, int count) {
+	srand(shape + 1);
+	for (int i = 0; i < count; i++) {
+#ifndef SSD1306_ROTATION
+		display.setRotation(i & 3);
+#endif
+		bool anywhere = !(rand() % 4);
+		int x0 = randomCoordinate(display.width(), anywhere), y0 = randomCoordinate(display.height(), anywhere);
+		int x1 = randomCoordinate(display.width(), anywhere), y1 = randomCoordinate(display.height(), anywhere);
+		int r = rand() % 40;
+		uint16_t color = rand() % 3;
+		checkShape(shape, x0, y0, x1, y1, r, color, i);
+	}
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+}
+
+void tearDown(void) {
+#ifndef SSD1306_ROTATION
+	display.setRotation(0);
+#endif
+}
+
+void test_draw_line(void) {
+	checkRandomShapes(Shape_Line, 20000);
+}
+
+void test_draw_circle(void) {
+	checkRandomShapes(Shape_Circle, 20000);
+}
+
+// single points, the axes and diagonals both ways, and the panel's edges
+void test_special_lines(void) {
+	static const int lines[][4] = {
+		{5, 5, 5, 5}, {0, 0, 127, 0}, {127, 63, 0, 63}, {3, 0, 3, 63}, {9, 60, 9, 2},
+		{0, 0, 63, 63}, {63, 63, 0, 0}, {0, 63, 63, 0}, {127, 0, 64, 63},
+		{0, 7, 127, 8}, {0, 8, 127, 7}, {10, 0, 11, 63}, {-1, 0, 127, 63}, {0, 0, 128, 63}
+	};
+	for (unsigned i = 0; i < sizeof lines / sizeof lines[0]; i++) {
+		for (uint16_t color = BLACK; color <= INVERSE; color++)
+			checkShape(Shape_Line, lines[i][0], lines[i][1], lines[i][2], lines[i][3], 0, color, i);
+	}
+}
+
+// radius 0 and 1, and circles just touching each edge or just past it
+void test_special_circles(void) {
+	static const int circles[][3] = {
+		{20, 20, 0}, {20, 20, 1}, {31, 31, 31}, {96, 32, 31}, {64, 32, 32},
+		{10, 10, 10}, {10, 10, 11}, {117, 53, 10}, {117, 53, 11}, {64, 3, 4}
+	};
+	for (unsigned i = 0; i < sizeof circles / sizeof circles[0]; i++) {
+		for (uint16_t color = BLACK; color <= INVERSE; color++)
+			checkShape(Shape_Circle, circles[i][0], circles[i][1], 0, 0, circles[i][2], color, i);
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_draw_line);
+	RUN_TEST(test_draw_circle);
+	RUN_TEST(test_special_lines);
+	RUN_TEST(test_special_circles);
+	return UNITY_END();
+}
@@ -0,0 +1,134 @@
+// The page-byte rectangles of Adafruit_SSD1306 against the generic ones in
+// Adafruit_GFX_Core: fillRect(), drawRect() and fillScreen() must set the
+// same pixels, on and off the panel, in every rotation and colour.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+typedef Adafruit_GFX_Core<Adafruit_SSD1306> Generic;
+
+typedef enum {
+	Shape_Fill,
+	Shape_Outline
+} Shape;
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t generic[BUFFER_SIZE];
+
+// stripes underneath, so clearing and flipping show up
+static void drawStripes(int offset) {
+	for (int i = offset % 8; i < SSD1306_LCDWIDTH; i += 8)
+		display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+}
+
+static void drawShape(bool own, Shape shape, int x, int y, int w, int h, uint16_t color, int offset) {
+	display.firstPage();
+	do {
+		drawStripes(offset);
+		if (shape == Shape_Fill) {
+			if (own)
+				display.fillRect(x, y, w, h, color);
+			else
+				Generic::fillRect(display, x, y, w, h, color);
+		} else {
+			if (own)
+				display.drawRect(x, y, w, h, color);
+			else
+				Generic::drawRect(display, x, y, w, h, color);
+		}
+	} while (display.nextPage());
+}
+
+static void checkShape(Shape shape, int x, int y, int w, int h, uint16_t color, int offset) {
+	drawShape(false, shape, x, y, w, h, color, offset);
+	memcpy(generic, model_gddram(), BUFFER_SIZE);
+	drawShape(true, shape, x, y, w, h, color, offset);
+
+	char message[64];
+	snprintf(message, sizeof message, "%s %d,%d %dx%d color %d rotation %d",
+		(shape == Shape_Fill) ? "fillRect" : "drawRect", x, y, w, h, color, display.getRotation());
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(generic, model_gddram(), BUFFER_SIZE, message);
+}
+
+static void checkRandomShapes(Shape shape, int count) {
+	srand(shape + 1);
+	for (int i = 0; i < count; i++) {
+#ifndef SSD1306_ROTATION
+		display.setRotation(i & 3);
+#endif
+		int x = rand() % 160 - 16, y = rand() % 100 - 18;
+		int w = rand() % 90 + 1, h = rand() % 80 + 1;
+		uint16_t color = rand() % 3;
+		if ((shape == Shape_Outline) && (color == INVERSE)) {
+			// the generic outline flips its corners twice
+			color = WHITE;
+		}
+		checkShape(shape, x, y, w, h, color, i);
+	}
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+}
+
+void tearDown(void) {
+#ifndef SSD1306_ROTATION
+	display.setRotation(0);
+#endif
+}
+
+void test_fill_rect(void) {
+	checkRandomShapes(Shape_Fill, 20000);
+}
+
+void test_draw_rect(void) {
+	checkRandomShapes(Shape_Outline, 20000);
+}
+
+// one pixel and one row or column, inside a page and across pages
+void test_thin_rects(void) {
+	static const int rects[][4] = {
+		{5, 5, 1, 1}, {5, 7, 1, 2}, {0, 8, 128, 1}, {3, 0, 1, 64}, {10, 6, 20, 3}, {127, 63, 1, 1}, {-3, -3, 4, 4}
+	};
+	for (unsigned i = 0; i < sizeof rects / sizeof rects[0]; i++) {
+		for (uint16_t color = BLACK; color <= INVERSE; color++) {
+			checkShape(Shape_Fill, rects[i][0], rects[i][1], rects[i][2], rects[i][3], color, i);
+			if (color != INVERSE)
+				checkShape(Shape_Outline, rects[i][0], rects[i][1], rects[i][2], rects[i][3], color, i);
+		}
+	}
+}
+
+void test_fill_screen(void) {
+	for (uint16_t color = BLACK; color <= INVERSE; color++) {
+		display.firstPage();
+		do {
+			display.drawLine(0, 0, 127, 63, WHITE);
+			Generic::fillScreen(display, color);
+		} while (display.nextPage());
+		memcpy(generic, model_gddram(), BUFFER_SIZE);
+
+		display.firstPage();
+		do {
+			display.drawLine(0, 0, 127, 63, WHITE);
+			display.fillScreen(color);
+		} while (display.nextPage());
+
+		TEST_ASSERT_EQUAL_MEMORY(generic, model_gddram(), BUFFER_SIZE);
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_fill_rect);
+	RUN_TEST(test_draw_rect);
+	RUN_TEST(test_thin_rects);
+	RUN_TEST(test_fill_screen);
+	return UNITY_END();
+}
@@ -0,0 +1,110 @@
+// SSD1306_SHADOW_FRAME: unchanged chunks are skipped, and a chunk skipped
+// because its new contents have the old CRC is put right by the periodic
+// full resend.
+//
+//   platformio test -e native_shadow
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include "ssd1306_model.h"
+
+#ifndef SSD1306_SHADOW_FRAME
+#error "test_shadow needs SSD1306_SHADOW_FRAME"
+#endif
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+static Adafruit_SSD1306 display(-1);
+
+// what the panel should show, drawn alongside the display
+static uint8_t expected[BUFFER_SIZE];
+
+static void fillRect(int x, int y, int w, int h, uint16_t color) {
+	display.fillRect(x, y, w, h, color);
+	for (int j = y; j < y + h; j++) {
+		for (int i = x; i < x + w; i++) {
+			uint8_t &b = expected[(j / 8) * SSD1306_LCDWIDTH + i];
+			uint8_t bit = 1 << (j & 7);
+			b = (color == WHITE) ? (b | bit) : (color == BLACK) ? (b & ~bit) : (b ^ bit);
+		}
+	}
+}
+
+static int staleChunks(void) {
+	int stale = 0;
+	for (int i = 0; i < BUFFER_SIZE; i += SSD1306_CHUNK_SIZE) {
+		if (memcmp(&expected[i], &model_gddram()[i], SSD1306_CHUNK_SIZE))
+			stale++;
+	}
+	return stale;
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	display.clearDisplay();
+	display.display();
+	memset(expected, 0, sizeof(expected));
+	model_reset_stats();
+}
+
+void tearDown(void) {
+}
+
+void test_unchanged_chunks_skipped(void) {
+	fillRect(10, 10, 20, 20, WHITE);
+	display.display();
+	model_reset_stats();
+
+	// the same frame again, cleared and redrawn
+	display.clearDisplay();
+	fillRect(10, 10, 20, 20, WHITE);
+	display.display();
+	TEST_ASSERT_EQUAL(0, model_stats().dataBytes);
+	TEST_ASSERT_EQUAL(SSD1306_CHUNKS, display.getSkippedChunks());
+	TEST_ASSERT_EQUAL(0, staleChunks());
+}
+
+void test_collision_resent_by_refresh(void) {
+	// first chunk of page 0: all zero has the same CRC as these columns
+	static const uint8_t PROGMEM columns[] = {0xFF, 0x00, 0xC0, 0xFF};
+	display.drawPageBitmap(0, 0, columns, sizeof(columns), 8, SSD1306_COPY);
+	memcpy(expected, columns, sizeof(columns));
+
+	display.display();
+	TEST_ASSERT_EQUAL(1, staleChunks());
+
+	int flushes = 1;
+	while (staleChunks()) {
+		TEST_ASSERT_LESS_THAN(SSD1306_SHADOW_REFRESH, flushes);
+		display.display();
+		flushes++;
+	}
+}
+
+void test_random_frames(void) {
+	srand(1);
+	for (int frame = 0; frame < 5000; frame++) {
+		display.clearDisplay();
+		memset(expected, 0, sizeof(expected));
+		for (int i = 0; i < 8; i++) {
+			int x = rand() % SSD1306_LCDWIDTH, y = rand() % SSD1306_LCDHEIGHT;
+			int w = 1 + rand() % (SSD1306_LCDWIDTH - x), h = 1 + rand() % (SSD1306_LCDHEIGHT - y);
+			fillRect(x, y, w, h, rand() % 3);
+		}
+		display.display();
+
+		// a collision may leave a chunk behind, but never for more than a refresh
+		if ((frame % 500) == 499) {
+			for (int i = 0; i < SSD1306_SHADOW_REFRESH; i++)
+				display.display();
+			TEST_ASSERT_EQUAL(0, staleChunks());
+		}
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_unchanged_chunks_skipped);
+	RUN_TEST(test_collision_resent_by_refresh);
+	RUN_TEST(test_random_frames);
+	return UNITY_END();
+}
@@ -0,0 +1,8 @@
+// The text test_subset prints, and the source the subset fonts in
+// ../fonts were converted from with fontconvert -s.  Comments like this
+// one don't count, only what is in the literals below.
+static const char *const subsetText[] = {
+	"PLAYER 10", "AI 7", "YOU WIN!", "YOU LOSE", "\"Pong\" 3:2"
+};
+
+static const char subsetPrompt = '>';
@@ -0,0 +1,161 @@
+// Subset fonts: converted with fontconvert -s from the literals in
+// subset_text.h, a font must hold exactly those characters, with the full
+// font's glyph boxes, and print them with the same pixels and cursor.
+// Characters it doesn't hold are skipped.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include "ssd1306_model.h"
+
+#include "subset_text.h"
+#include "../fonts/Lato9pt7b.h"
+#include "../fonts/Lato9pt7bs.h"
+#include "../fonts/Lato9pt7brs.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+#define TEXT_COUNT (sizeof subsetText / sizeof subsetText[0])
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t full[BUFFER_SIZE];
+static int16_t fullX, fullY;
+
+// stripes underneath, so clearing and flipping show up
+static void printText(const GFXfont *font, int x, int y, const char *text, uint16_t color, uint8_t size) {
+	display.firstPage();
+	do {
+		for (int i = 0; i < SSD1306_LCDWIDTH; i += 8)
+			display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+		display.setFont(font);
+		display.setTextSize(size);
+		display.setTextColor(color);
+		display.setCursor(x, y);
+		display.print(text);
+	} while (display.nextPage());
+}
+
+static bool inSubset(char c) {
+	if (c == subsetPrompt)
+		return true;
+	for (unsigned t = 0; t < TEXT_COUNT; t++) {
+		if (strchr(subsetText[t], c))
+			return true;
+	}
+	return false;
+}
+
+// the full font printing only what the subset holds, the subset printing
+// all of text
+static void checkText(const GFXfont *subset, int x, int y, const char *text, uint16_t color, uint8_t size) {
+	char held[64];
+	int n = 0;
+	for (const char *p = text; *p; p++) {
+		if (inSubset(*p))
+			held[n++] = *p;
+	}
+	held[n] = '\0';
+
+	printText(&Lato9pt7b, x, y, held, color, size);
+	memcpy(full, model_gddram(), BUFFER_SIZE);
+	fullX = display.getCursorX();
+	fullY = display.getCursorY();
+	printText(subset, x, y, text, color, size);
+
+	char message[80];
+	snprintf(message, sizeof message, "\"%s\" at %d,%d color %d size %d", text, x, y, color, size);
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(full, model_gddram(), BUFFER_SIZE, message);
+	TEST_ASSERT_EQUAL_MESSAGE(fullX, display.getCursorX(), message);
+	TEST_ASSERT_EQUAL_MESSAGE(fullY, display.getCursorY(), message);
+
+	int16_t fx, fy, sx, sy;
+	uint16_t fw, fh, sw, sh;
+	display.setFont(&Lato9pt7b);
+	display.getTextBounds(held, x, y, &fx, &fy, &fw, &fh);
+	display.setFont(subset);
+	display.getTextBounds((char *)text, x, y, &sx, &sy, &sw, &sh);
+	TEST_ASSERT_EQUAL_MESSAGE(fx, sx, message);
+	TEST_ASSERT_EQUAL_MESSAGE(fy, sy, message);
+	TEST_ASSERT_EQUAL_MESSAGE(fw, sw, message);
+	TEST_ASSERT_EQUAL_MESSAGE(fh, sh, message);
+}
+
+static void checkTexts(const GFXfont *subset, const char *const *texts, int count) {
+	static const int xs[] = {-7, 0, 3, 70};
+	static const int ys[] = {-3, 5, 12, 13, 20, 36, 70};
+
+	for (int t = 0; t < count; t++) {
+		for (unsigned i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+			for (unsigned j = 0; j < sizeof ys / sizeof ys[0]; j++) {
+				for (uint16_t color = BLACK; color <= INVERSE; color++)
+					checkText(subset, xs[i], ys[j], texts[t], color, 1);
+				checkText(subset, xs[i], ys[j], texts[t], WHITE, 2);
+			}
+		}
+	}
+}
+
+static void checkHolds(const GFXfont *subset) {
+	for (int c = 0; c < 256; c++) {
+		GFXglyph *glyph = Adafruit_GFX_findGlyph(subset, c);
+		char message[16];
+		snprintf(message, sizeof message, "code 0x%02X", c);
+		TEST_ASSERT_EQUAL_MESSAGE(c && inSubset(c), glyph != NULL, message);
+		if (!glyph)
+			continue;
+
+		GFXglyph *reference = Adafruit_GFX_findGlyph(&Lato9pt7b, c);
+		TEST_ASSERT_EQUAL_MESSAGE(reference->width, glyph->width, message);
+		TEST_ASSERT_EQUAL_MESSAGE(reference->height, glyph->height, message);
+		TEST_ASSERT_EQUAL_MESSAGE(reference->xAdvance, glyph->xAdvance, message);
+		TEST_ASSERT_EQUAL_MESSAGE(reference->xOffset, glyph->xOffset, message);
+		TEST_ASSERT_EQUAL_MESSAGE(reference->yOffset, glyph->yOffset, message);
+	}
+	TEST_ASSERT_EQUAL(Lato9pt7b.yAdvance, subset->yAdvance);
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	display.setTextWrap(false);
+}
+
+void tearDown(void) {
+	display.setFont(NULL);
+	display.setTextSize(1);
+}
+
+// the literals' characters and no others, comments left out
+void test_subset_holds_the_literals(void) {
+	checkHolds(&Lato9pt7bs);
+	checkHolds(&Lato9pt7brs);
+}
+
+void test_subset_prints_like_full_font(void) {
+	checkTexts(&Lato9pt7bs, subsetText, TEXT_COUNT);
+	checkTexts(&Lato9pt7brs, subsetText, TEXT_COUNT);
+}
+
+// codes below first, between the subset's and above last
+void test_missing_codes_skipped(void) {
+	static const char *const texts[] = {"\tYOU zWIN~", "P#LAY$ER 1x0", "A-I 7.>"};
+
+	checkTexts(&Lato9pt7bs, texts, sizeof texts / sizeof texts[0]);
+	checkTexts(&Lato9pt7brs, texts, sizeof texts / sizeof texts[0]);
+}
+
+// wrapping decides on the glyphs the subset has
+void test_subset_wraps_like_full_font(void) {
+	display.setTextWrap(true);
+	checkText(&Lato9pt7bs, 60, 12, "YOU WIN! YOU LOSE PLAYER 10", WHITE, 1);
+	checkText(&Lato9pt7brs, 60, 12, "YOU WIN! qYOU LOSE PLAYER 10", WHITE, 1);
+	checkText(&Lato9pt7bs, 30, 20, "YOU LOSE", WHITE, 2);
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_subset_holds_the_literals);
+	RUN_TEST(test_subset_prints_like_full_font);
+	RUN_TEST(test_missing_codes_skipped);
+	RUN_TEST(test_subset_wraps_like_full_font);
+	return UNITY_END();
+}
@@ -0,0 +1,124 @@
+// SSD1306_TEXT_CACHE: drawCachedText() puts the same pixels on the panel
+// as drawing the text glyph by glyph with drawChar(), wherever it lands,
+// and renders a slot again when its text or size changes.
+//
+//   platformio test -e native_text
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#include "../fonts/Lato9pt7b.h"
+
+#ifndef SSD1306_TEXT_CACHE
+#error "test_text needs SSD1306_TEXT_CACHE"
+#endif
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t cached[BUFFER_SIZE];
+
+// set while drawCachedText() runs, for other text on the panel
+static const GFXfont *otherFont;
+
+// the same scattered pixels under both versions of the text
+static void drawBackground(unsigned seed) {
+	srand(seed);
+	display.clearDisplay();
+	for (int i = 0; i < 400; i++)
+		display.drawPixel(rand() % SSD1306_LCDWIDTH, rand() % SSD1306_LCDHEIGHT, WHITE);
+}
+
+static void drawGlyphs(int x, int y, const char *text, uint8_t size, uint16_t color, uint16_t bg) {
+	for (; *text; text++, x += 6 * size)
+		display.drawChar(x, y, *text, color, bg, size);
+}
+
+// draws text both ways over the same background and compares the panels
+static void checkText(uint8_t slot, int x, int y, const char *text, uint8_t size, uint16_t color, uint16_t bg) {
+	unsigned seed = x * 1000 + y * 10 + size;
+
+	drawBackground(seed);
+	display.setTextSize(size);
+	display.setTextColor(color, bg);
+	display.setFont(otherFont);
+	display.drawCachedText(slot, x, y, text);
+	display.setFont(NULL);
+	display.display();
+	memcpy(cached, model_gddram(), BUFFER_SIZE);
+
+	drawBackground(seed);
+	drawGlyphs(x, y, text, size, color, bg);
+	display.display();
+
+	char message[64];
+	snprintf(message, sizeof message, "\"%s\" size %d at %d,%d color %d bg %d", text, size, x, y, color, bg);
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(model_gddram(), cached, BUFFER_SIZE, message);
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	display.setTextWrap(false);
+}
+
+void tearDown(void) {
+	otherFont = NULL;
+}
+
+// every row offset within a page, and text hanging off each edge
+void test_positions(void) {
+	static const int xs[] = {-20, -1, 0, 5, 45, 100, 120, 127};
+	static const int ys[] = {-17, -9, -3, 0, 1, 4, 7, 8, 13, 30, 50, 57, 60, 63};
+
+	for (uint8_t size = 1; size <= 3; size++) {
+		for (unsigned i = 0; i < sizeof xs / sizeof xs[0]; i++) {
+			for (unsigned j = 0; j < sizeof ys / sizeof ys[0]; j++)
+				checkText(0, xs[i], ys[j], "42", size, WHITE, WHITE);
+		}
+	}
+}
+
+// transparent and opaque text, and the inverse colours
+void test_colors(void) {
+	static const uint16_t colors[][2] = {{WHITE, WHITE}, {WHITE, BLACK}, {BLACK, BLACK}, {BLACK, WHITE}, {INVERSE, INVERSE}};
+
+	for (unsigned i = 0; i < sizeof colors / sizeof colors[0]; i++) {
+		checkText(0, 45, 3, "9", 2, colors[i][0], colors[i][1]);
+		checkText(1, 75, 0, "10", 2, colors[i][0], colors[i][1]);
+	}
+}
+
+// a slot drawn again with new text or at a new size is rendered again
+void test_slot_rerendered_on_change(void) {
+	checkText(0, 45, 0, "0", 2, WHITE, WHITE);
+	checkText(0, 45, 0, "1", 2, WHITE, WHITE);
+	checkText(0, 45, 0, "11", 2, WHITE, WHITE);
+	checkText(0, 45, 0, "11", 1, WHITE, WHITE);
+	checkText(1, 75, 0, "11", 3, WHITE, WHITE);
+	checkText(0, 45, 0, "11", 1, WHITE, WHITE);
+}
+
+// text too long for a slot falls back to drawChar()
+void test_too_long(void) {
+	checkText(0, 0, 20, "12345678", 1, WHITE, BLACK);
+}
+
+// a custom font set for other text doesn't change the cached text, nor
+// the text drawn glyph by glyph
+void test_custom_font_set(void) {
+	otherFont = &Lato9pt7b;
+	checkText(0, 45, 3, "42", 2, WHITE, BLACK);
+	checkText(1, 0, 20, "12345678", 1, WHITE, BLACK);
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_positions);
+	RUN_TEST(test_colors);
+	RUN_TEST(test_slot_rerendered_on_change);
+	RUN_TEST(test_too_long);
+	RUN_TEST(test_custom_font_set);
+	return UNITY_END();
+}
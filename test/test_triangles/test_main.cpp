@@ -0,0 +1,180 @@
+// fillTriangle() without a division per row: the edge stepping in
+// Adafruit_GFX_triangleSpans(), through Adafruit_GFX_Core and through
+// Adafruit_SSD1306's own row stores, must set the same pixels as the
+// division-based Adafruit_GFX code it replaced, for every kind of
+// triangle, on and off the panel, in every rotation and colour.
+//
+//   platformio test -e native
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include <stdlib.h>
+#include "ssd1306_model.h"
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+typedef Adafruit_GFX_Core<Adafruit_GFX> Generic;
+
+typedef enum {
+	Fill_Division,	// the Adafruit_GFX original, below
+	Fill_Generic,
+	Fill_Own
+} Fill;
+
+static Adafruit_SSD1306 display(-1);
+
+static uint8_t reference[BUFFER_SIZE];
+
+static void swap16(int16_t &a, int16_t &b) {
+	int16_t t = a;
+	a = b;
+	b = t;
+}
+
+// Adafruit_GFX::fillTriangle() as it was, dividing on every row
+static void divisionTriangle(Adafruit_GFX &gfx, int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color) {
+	int16_t a, b, y, last;
+
+	if (y0 > y1) {
+		swap16(y0, y1); swap16(x0, x1);
+	}
+	if (y1 > y2) {
+		swap16(y2, y1); swap16(x2, x1);
+	}
+	if (y0 > y1) {
+		swap16(y0, y1); swap16(x0, x1);
+	}
+
+	if (y0 == y2) {
+		a = b = x0;
+		if (x1 < a) a = x1;
+		else if (x1 > b) b = x1;
+		if (x2 < a) a = x2;
+		else if (x2 > b) b = x2;
+		gfx.drawFastHLine(a, y0, b - a + 1, color);
+		return;
+	}
+
+	int16_t dx01 = x1 - x0, dy01 = y1 - y0, dx02 = x2 - x0, dy02 = y2 - y0, dx12 = x2 - x1, dy12 = y2 - y1;
+	int32_t sa = 0, sb = 0;
+
+	last = (y1 == y2) ? y1 : y1 - 1;
+	for (y = y0; y <= last; y++) {
+		a = x0 + sa / dy01;
+		b = x0 + sb / dy02;
+		sa += dx01;
+		sb += dx02;
+		if (a > b) swap16(a, b);
+		gfx.drawFastHLine(a, y, b - a + 1, color);
+	}
+
+	sa = (int32_t)dx12 * (y - y1);
+	sb = (int32_t)dx02 * (y - y0);
+	for (; y <= y2; y++) {
+		a = x1 + sa / dy12;
+		b = x0 + sb / dy02;
+		sa += dx12;
+		sb += dx02;
+		if (a > b) swap16(a, b);
+		gfx.drawFastHLine(a, y, b - a + 1, color);
+	}
+}
+
+// stripes underneath, so clearing and flipping show up
+static void drawTriangle(Fill fill, const int16_t *p, uint16_t color, int offset) {
+	Adafruit_GFX &gfx = display;
+
+	display.firstPage();
+	do {
+		for (int i = offset % 8; i < SSD1306_LCDWIDTH; i += 8)
+			display.drawFastVLine(i, 0, SSD1306_LCDHEIGHT, WHITE);
+		switch (fill) {
+		case Fill_Division:
+			divisionTriangle(gfx, p[0], p[1], p[2], p[3], p[4], p[5], color);
+			break;
+		case Fill_Generic:
+			Generic::fillTriangle(gfx, p[0], p[1], p[2], p[3], p[4], p[5], color);
+			break;
+		case Fill_Own:
+			display.fillTriangle(p[0], p[1], p[2], p[3], p[4], p[5], color);
+			break;
+		}
+	} while (display.nextPage());
+}
+
+static void checkTriangle(const int16_t *p, uint16_t color, int offset) {
+	drawTriangle(Fill_Division, p, color, offset);
+	memcpy(reference, model_gddram(), BUFFER_SIZE);
+
+	char message[80];
+	snprintf(message, sizeof message, "%d,%d %d,%d %d,%d color %d rotation %d",
+		p[0], p[1], p[2], p[3], p[4], p[5], color, display.getRotation());
+
+	drawTriangle(Fill_Generic, p, color, offset);
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference, model_gddram(), BUFFER_SIZE, message);
+	drawTriangle(Fill_Own, p, color, offset);
+	TEST_ASSERT_EQUAL_MEMORY_MESSAGE(reference, model_gddram(), BUFFER_SIZE, message);
+}
+
+// the corners within range of the panel, and in some triangles the
+// second shares its row with the first (flat top) or third (flat bottom)
+static void checkRandomTriangles(int count, int range, unsigned seed) {
+	srand(seed);
+	for (int i = 0; i < count; i++) {
+#ifndef SSD1306_ROTATION
+		display.setRotation(i & 3);
+#endif
+		int16_t p[6];
+		for (int j = 0; j < 6; j += 2) {
+			p[j] = rand() % (SSD1306_LCDWIDTH + 2 * range) - range;
+			p[j + 1] = rand() % (SSD1306_LCDHEIGHT + 2 * range) - range;
+		}
+		switch (rand() % 4) {
+		case 0: p[3] = p[1]; break;
+		case 1: p[3] = p[5]; break;
+		}
+		checkTriangle(p, rand() % 3, i);
+	}
+}
+
+void setUp(void) {
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+}
+
+void tearDown(void) {
+#ifndef SSD1306_ROTATION
+	display.setRotation(0);
+#endif
+}
+
+void test_random_triangles(void) {
+	checkRandomTriangles(20000, 20, 1);
+}
+
+// large triangles with corners far off the panel
+void test_off_panel_triangles(void) {
+	checkRandomTriangles(5000, 1000, 2);
+}
+
+// flat tops and bottoms, a row, a column, a point and corners in a line
+void test_special_triangles(void) {
+	static const int16_t triangles[][6] = {
+		{10, 10, 50, 10, 30, 40}, {30, 5, 10, 40, 50, 40},
+		{0, 0, 127, 0, 127, 63}, {0, 63, 127, 63, 64, 0},
+		{5, 20, 90, 20, 40, 20}, {40, 3, 40, 60, 40, 30},
+		{64, 32, 64, 32, 64, 32}, {0, 0, 30, 15, 60, 30},
+		{-10, -10, 137, 20, 50, 73}, {-50, 30, -20, 10, -5, 60},
+		{130, 5, 200, 40, 140, 60}, {20, -40, 60, -5, 100, -20}
+	};
+	for (unsigned i = 0; i < sizeof triangles / sizeof triangles[0]; i++) {
+		for (uint16_t color = BLACK; color <= INVERSE; color++)
+			checkTriangle(triangles[i], color, i);
+	}
+}
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_random_triangles);
+	RUN_TEST(test_off_panel_triangles);
+	RUN_TEST(test_special_triangles);
+	return UNITY_END();
+}
@@ -0,0 +1,198 @@
+// SSD1306_TWI_DIRECT and SSD1306_TWI_ASYNC against the register mock in
+// lib/ArduinoNative/twi_mock.cpp: the bytes a flush puts on the bus, and
+// the TWI interrupt state machine run one interrupt at a time.
+//
+//   platformio test -e native_twi_direct
+//   platformio test -e native_twi
+#include <Adafruit_SSD1306.h>
+#include <unity.h>
+#include "ssd1306_model.h"
+#include "twi_mock.h"
+
+#ifndef SSD1306_TWI_DIRECT
+#error "test_twi needs SSD1306_TWI_DIRECT or SSD1306_TWI_ASYNC"
+#endif
+
+#define BUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
+
+static Adafruit_SSD1306 display(-1);
+
+// what the panel should show, drawn alongside the display
+static uint8_t expected[BUFFER_SIZE];
+
+static void fillRect(int x, int y, int w, int h, uint16_t color) {
+	display.fillRect(x, y, w, h, color);
+	for (int j = y; j < y + h; j++) {
+		for (int i = x; i < x + w; i++) {
+			uint8_t bit = 1 << (j & 7);
+			if (color == WHITE)
+				expected[(j / 8) * SSD1306_LCDWIDTH + i] |= bit;
+			else
+				expected[(j / 8) * SSD1306_LCDWIDTH + i] &= ~bit;
+		}
+	}
+}
+
+static bool panelCurrent(void) {
+	return memcmp(expected, model_gddram(), BUFFER_SIZE) == 0;
+}
+
+void setUp(void) {
+	twi_mock_hold(false);
+	twi_mock_nack_after(-1);
+	display.begin(SSD1306_SWITCHCAPVCC, SSD1306_I2C_ADDRESS);
+	display.clearDisplay();
+	display.display();
+	memset(expected, 0, sizeof(expected));
+	model_reset_stats();
+	twi_mock_clear_log();
+}
+
+void tearDown(void) {
+	twi_mock_hold(false);
+}
+
+void test_bitrate_set_once(void) {
+	// 400KHz at 16MHz, from begin() on
+	TEST_ASSERT_EQUAL(12, TWBR);
+}
+
+void test_window_byte_stream(void) {
+	// columns 20..29 of page 1
+	fillRect(20, 8, 10, 8, WHITE);
+	display.display();
+
+	static const uint8_t stream[] = {
+		SSD1306_I2C_ADDRESS << 1,
+		0x80, SSD1306_COLUMNADDR, 0x80, 20, 0x80, 29,
+		0x80, SSD1306_PAGEADDR, 0x80, 1, 0x80, 1,
+		0x40,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+	};
+	uint16_t length;
+	const uint8_t *sent = twi_mock_log(&length);
+	TEST_ASSERT_EQUAL(1, model_stats().transactions);
+	TEST_ASSERT_EQUAL(sizeof(stream), length);
+	TEST_ASSERT_EQUAL_MEMORY(stream, sent, sizeof(stream));
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+
+#ifndef SSD1306_SHADOW_FRAME
+void test_frame_in_one_transaction(void) {
+	fillRect(0, 0, 128, 64, WHITE);
+	display.display();
+
+	// SLA+W, the addressing, one control byte and the whole buffer
+	uint16_t length;
+	const uint8_t *sent = twi_mock_log(&length);
+	TEST_ASSERT_EQUAL(1, model_stats().transactions);
+	TEST_ASSERT_EQUAL(1 + 12 + 1 + BUFFER_SIZE, length);
+	TEST_ASSERT_EQUAL(0x40, sent[13]);
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+#endif
+
+#ifndef SSD1306_TWI_ASYNC
+void test_nack_ends_window_and_resends(void) {
+	fillRect(0, 0, 128, 64, WHITE);
+	twi_mock_nack_after(100);
+	display.display();
+	TEST_ASSERT_FALSE(panelCurrent());
+
+	// nothing sent after the byte that was not acknowledged
+	uint16_t length;
+	twi_mock_log(&length);
+	TEST_ASSERT_EQUAL(1 + 100 + 1, length);
+
+	// nothing new drawn, but the panel may hold anything: all of it again
+	model_reset_stats();
+	display.display();
+	TEST_ASSERT_EQUAL(BUFFER_SIZE, model_stats().dataBytes);
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+
+void test_nack_on_command_resends(void) {
+	twi_mock_nack_after(0);
+	display.dim(true);
+
+	model_reset_stats();
+	display.display();
+	TEST_ASSERT_EQUAL(BUFFER_SIZE, model_stats().dataBytes);
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+#endif
+
+#ifdef SSD1306_TWI_ASYNC
+void test_flush_runs_from_interrupt(void) {
+	fillRect(10, 4, 30, 20, WHITE);
+
+	twi_mock_hold(true);
+	display.displayAsync();
+	TEST_ASSERT_TRUE(display.isFlushing());
+	TEST_ASSERT_EQUAL(0, model_stats().transactions);
+
+	// an interrupt per START, SLA+W, each of the 13 addressing and control
+	// bytes and each data byte; the last one sends the STOP
+	unsigned long interrupts = 0;
+	while (twi_mock_step())
+		interrupts++;
+	const ModelStats &s = model_stats();
+	TEST_ASSERT_FALSE(display.isFlushing());
+	TEST_ASSERT_GREATER_THAN(0, s.transactions);
+	TEST_ASSERT_EQUAL(15 * s.transactions + s.dataBytes, interrupts);
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+
+void test_nack_abandons_flush_and_resends(void) {
+	fillRect(0, 0, 128, 64, WHITE);
+	twi_mock_nack_after(100);
+	display.displayAsync();
+	display.waitFlush();
+	TEST_ASSERT_FALSE(panelCurrent());
+
+	// nothing new drawn, but the panel may hold anything: all of it again
+	model_reset_stats();
+	display.displayAsync();
+	display.waitFlush();
+	TEST_ASSERT_EQUAL(BUFFER_SIZE, model_stats().dataBytes);
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+
+void test_drawing_during_flush(void) {
+	fillRect(0, 0, 16, 8, WHITE);
+	display.display();
+
+	// cleared, and drawn back before the clearing has gone out
+	fillRect(0, 0, 16, 8, BLACK);
+	twi_mock_hold(true);
+	display.displayAsync();
+	display.fillRect(0, 0, 16, 8, WHITE);
+	twi_mock_hold(false);
+	TEST_ASSERT_FALSE(panelCurrent());
+
+	// cleared again: the buffer is back to what the flush started with
+	display.fillRect(0, 0, 16, 8, BLACK);
+	display.displayAsync();
+	display.waitFlush();
+	TEST_ASSERT_TRUE(panelCurrent());
+}
+#endif
+
+int main(int argc, char **argv) {
+	UNITY_BEGIN();
+	RUN_TEST(test_bitrate_set_once);
+	RUN_TEST(test_window_byte_stream);
+#ifndef SSD1306_SHADOW_FRAME
+	RUN_TEST(test_frame_in_one_transaction);
+#endif
+#ifndef SSD1306_TWI_ASYNC
+	RUN_TEST(test_nack_ends_window_and_resends);
+	RUN_TEST(test_nack_on_command_resends);
+#endif
+#ifdef SSD1306_TWI_ASYNC
+	RUN_TEST(test_flush_runs_from_interrupt);
+	RUN_TEST(test_nack_abandons_flush_and_resends);
+	RUN_TEST(test_drawing_during_flush);
+#endif
+	return UNITY_END();
+}
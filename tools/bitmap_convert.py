@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+"""Convert a row-major PBM image into a page-format bitmap for the SSD1306.
+
+    bitmap_convert.py splash.pbm                 # C array on stdout
+    bitmap_convert.py splash.pbm SPLASH --invert
+
+The output is laid out like the panel's buffer: a byte per column for each
+8 rows, bit 0 at the top, page after page, with the bits below the last row
+clear.  That is what drawSprite() and drawPageBitmap() expect.
+
+A 1 in the PBM is a lit pixel, the same way round as the frames the native
+build writes, so a dumped frame converts back to what was on the panel.
+--invert swaps that for images drawn dark on light.
+"""
+
+import os
+import re
+import sys
+
+
+def read_pbm(data):
+    """Return (width, height, rows) with rows a list of lists of 0/1."""
+    # header fields, skipping comments, up to the single whitespace before the raster
+    fields = []
+    pos = 0
+    while len(fields) < 3:
+        m = re.compile(rb"\s*(#[^\n]*\n\s*)*(\S+)").match(data, pos)
+        if not m:
+            raise ValueError("truncated PBM header")
+        fields.append(m.group(2))
+        pos = m.end()
+    magic, width, height = fields[0], int(fields[1]), int(fields[2])
+
+    if magic == b"P4":
+        pos += 1
+        stride = (width + 7) // 8
+        rows = []
+        for y in range(height):
+            line = data[pos + y * stride:pos + (y + 1) * stride]
+            if len(line) < stride:
+                raise ValueError("truncated PBM raster")
+            rows.append([(line[x // 8] >> (7 - x % 8)) & 1 for x in range(width)])
+        return width, height, rows
+
+    if magic == b"P1":
+        bits = [int(b) for b in re.findall(rb"[01]", data[pos:])]
+        if len(bits) < width * height:
+            raise ValueError("truncated PBM raster")
+        return width, height, [bits[y * width:(y + 1) * width] for y in range(height)]
+
+    raise ValueError("not a PBM image (P1 or P4)")
+
+
+def to_pages(width, height, rows, invert=False):
+    """Pack rows into a byte per column per page, bit 0 the top row."""
+    out = []
+    for page in range((height + 7) // 8):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = page * 8 + bit
+                if y < height and rows[y][x] ^ invert:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def c_array(name, width, height, data):
+    lines = ["// %dx%d, page format (drawSprite / drawPageBitmap)" % (width, height),
+             "static const uint8_t %s[] PROGMEM = {" % name]
+    for i in range(0, len(data), width if width <= 16 else 16):
+        chunk = data[i:i + (width if width <= 16 else 16)]
+        lines.append("\t" + ", ".join("0x%02X" % b for b in chunk) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    args = [a for a in sys.argv[1:] if a != "--invert"]
+    invert = len(args) != len(sys.argv) - 1
+    if len(args) not in (1, 2):
+        sys.exit(__doc__)
+
+    path = args[0]
+    name = args[1] if len(args) == 2 else re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0]).upper()
+
+    with open(path, "rb") as f:
+        width, height, rows = read_pbm(f.read())
+    if width > 255 or height > 255:
+        sys.exit("%s is %dx%d, bitmaps are at most 255x255" % (path, width, height))
+
+    print(c_array(name, width, height, to_pages(width, height, rows, invert)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Decode the frame timing records a PONG_PROFILE build sends over Serial.
+
+    profile_decode.py /dev/ttyACM0        # live, needs pyserial
+    profile_decode.py capture.bin         # a saved capture
+
+Each record is the sync bytes A5 5A, then version, stage count, histogram
+bin count and frame count (u16), one block per stage (count u16,
+min/max/total u32, histogram of u16, if any), and an 8-bit sum of
+everything after the sync bytes.  All values are little endian CPU cycles
+(16 per microsecond on an Uno).
+"""
+
+import os
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+VERSION = 3
+CPU_HZ = 16000000
+
+# order of the Stage enum in src/profile.h
+STAGES = ["physics", "goal", "wait", "clear", "ball", "paddles", "score", "display"]
+
+
+
+def stage_format(bins):
+    return "<HIII%dH" % bins
+
+
+def bin_label(i, bins):
+    if i == bins - 1:
+        return ">=%d" % (256 << (2 * (i - 1))) if i else "all"
+    return "<%d" % (256 << (2 * i))
+
+
+def read_records(stream, live=False):
+    """Yield (frames, bins, stages) for each intact record in a byte stream."""
+    data = b""
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            if live:
+                continue
+            return
+        data += chunk
+
+        while True:
+            start = data.find(SYNC)
+            if start < 0:
+                data = data[-1:]
+                break
+            data = data[start:]
+            if len(data) < 7:
+                break
+
+            version, count, bins, frames = struct.unpack_from("<BBBH", data, 2)
+            stage_size = struct.calcsize(stage_format(bins))
+            size = 7 + count * stage_size + 1
+            if len(data) < size:
+                break
+
+            if version != VERSION or sum(data[2:size - 1]) & 0xFF != data[size - 1]:
+                # not a record after all, look for the next sync
+                data = data[1:]
+                continue
+
+            stages = [struct.unpack_from(stage_format(bins), data, 7 + i * stage_size) for i in range(count)]
+            data = data[size:]
+            yield frames, bins, stages
+
+
+def print_record(frames, bins, stages):
+    print("%d frames" % frames)
+    header = "  %-8s %6s %10s %10s %10s" % ("stage", "count", "min us", "mean us", "max us")
+    if bins:
+        header += "  " + " ".join("%7s" % bin_label(i, bins) for i in range(bins))
+    print(header)
+    for i, fields in enumerate(stages):
+        count, low, high, total = fields[:4]
+        hist = fields[4:]
+        name = STAGES[i] if i < len(STAGES) else "stage%d" % i
+        if count == 0:
+            print("  %-8s %6d" % (name, 0))
+            continue
+        us = 1e6 / CPU_HZ
+        line = "  %-8s %6d %10.1f %10.1f %10.1f" % (name, count, low * us, total * us / count, high * us)
+        if bins:
+            line += "  " + " ".join("%7d" % h for h in hist)
+        print(line)
+    print()
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+
+    path = sys.argv[1]
+    live = not os.path.isfile(path)
+    if live:
+        import serial
+        stream = serial.Serial(path, 115200, timeout=1)
+    else:
+        stream = open(path, "rb")
+
+    for frames, bins, stages in read_records(stream, live):
+        print_record(frames, bins, stages)
+
+
+if __name__ == "__main__":
+    main()